@@ -788,7 +788,7 @@
  * When changing speed and direction, if the difference is less than the
  * value set here, it may happen instantaneously.
  */
-#define CLASSIC_JERK
+//#define CLASSIC_JERK
 #if ENABLED(CLASSIC_JERK)
   #define DEFAULT_XJERK 10.0
   #define DEFAULT_YJERK 10.0
@@ -815,6 +815,8 @@
   #define JUNCTION_DEVIATION_MM 0.013 // (mm) Distance from real junction edge
   #define JD_HANDLE_SMALL_SEGMENTS    // Use curvature estimation instead of just the junction angle
                                       // for small segments (< 1mm) with large junction angles (> 135°).
+  #define JD_USE_FACTOR_TABLE         // Interpolate the junction speed factor from a compile-time table
+                                      // instead of computing SQRT for every junction.
 #endif
 
 /**
@@ -825,7 +827,7 @@
  *
  * See https://github.com/synthetos/TinyG/wiki/Jerk-Controlled-Motion-Explained
  */
-//#define S_CURVE_ACCELERATION
+#define S_CURVE_ACCELERATION
 
 //===========================================================================
 //============================= Z Probe Options =============================
@@ -1260,7 +1262,7 @@
   // For Cartesian machines, instead of dividing moves on mesh boundaries,
   // split up moves into short segments like a Delta. This follows the
   // contours of the bed more closely than edge-to-edge straight moves.
-  #define SEGMENT_LEVELED_MOVES
+  //#define SEGMENT_LEVELED_MOVES
   #define LEVELED_SEGMENT_LENGTH 5.0 // (mm) Length of all segments (except the last one)
 
   /**
@@ -1298,6 +1300,10 @@
   //#define GRID_MAX_POINTS_Y GRID_MAX_POINTS_X
 
   //#define MESH_G28_REST_ORIGIN // After homing all axes ('G28' or 'G28 XYZ') rest Z at Z_MIN_POS
+
+  // Without SEGMENT_LEVELED_MOVES a move inside one mesh cell is only split
+  // as much as the cell's twist needs to stay within this Z error.
+  #define MBL_MAX_ERROR 0.005    // (mm) Largest Z error between segment ends
   #endif
 
   #if ENABLED(AUTO_BED_LEVELING_BILINEAR)
@@ -1316,6 +1322,17 @@
       #define BILINEAR_SUBDIVISIONS 3
     #endif
 
+    //
+    // Precompute fixed-point coefficients for each grid cell when the mesh
+    // changes, so the leveled Z of a point takes only a few integer ops.
+    // Without SEGMENT_LEVELED_MOVES a move inside one cell is only split as
+    // much as the cell's twist needs to stay within ABL_BILINEAR_MAX_ERROR.
+    //
+    #define ABL_BILINEAR_CACHE
+    #if ENABLED(ABL_BILINEAR_CACHE)
+      #define ABL_BILINEAR_MAX_ERROR 0.005 // (mm) Largest Z error between segment ends
+    #endif
+
   #endif
 
 #elif ENABLED(AUTO_BED_LEVELING_UBL)
@@ -887,6 +887,11 @@
 // if unwanted behavior is observed on a user's machine when running at very slow speeds.
 #define MINIMUM_PLANNER_SPEED 0.05 // (mm/s)
 
+// Use integer math in the trapezoid generator instead of float. Recommended for
+// MCUs without an FPU (e.g., AVR, STM32F1) running files with many short segments.
+// With MARLIN_DEV_MODE use D110 to compare the speed and results of both methods.
+//#define PLANNER_FIXED_POINT_TRAPEZOID
+
 //
 // Backlash Compensation
 // Adds extra movement to axes on direction-changes to account for backlash.
@@ -984,6 +989,34 @@
  */
 //#define ADAPTIVE_STEP_SMOOTHING
 
+/**
+ * Step Pulse DMA
+ * When the Stepper ISR takes several steps per interrupt (multi-stepping), hand
+ * each batch to a DMA stream paced by a timer, which writes the step pins'
+ * GPIO registers. The pulses are spread evenly over the ISR interval and the ISR
+ * no longer waits out the pulse widths, so higher step rates need fewer interrupts.
+ * Use with ADAPTIVE_STEP_SMOOTHING to make use of the extra headroom.
+ *
+ * STM32F1 high-density only. Uses Timer 8 and DMA2 channels 1-3.
+ * Step pins may be spread over at most three GPIO ports. One stepper per axis.
+ */
+//#define STEP_PULSE_DMA
+#if ENABLED(STEP_PULSE_DMA)
+  #define STEP_PULSE_DMA_EVENTS 32  // Largest batch handed to DMA. Uses 24 bytes of RAM per event.
+#endif
+
+/**
+ * Stepper ISR Profiling
+ * Count CPU cycles spent in each phase of the Stepper ISR (pulse, advance, block),
+ * how often the ISR runs out of loops and has to push the next interrupt out, and
+ * collect a histogram of ISR durations. Report with M990, reset with M990 R.
+ * Uses the DWT cycle counter on Cortex-M3/M4/M7 or the simulated clock on HAL/LINUX.
+ */
+//#define STEPPER_ISR_PROFILING
+#if ENABLED(STEPPER_ISR_PROFILING)
+  #define STEPPER_ISR_HISTOGRAM_US 2  // (µs) Width of each duration histogram bucket
+#endif
+
 /**
  * Custom Microstepping
  * Override as-needed for your setup. Up to 3 MS pins are supported.
@@ -1176,6 +1209,31 @@
 
   //#define SDCARD_READONLY                 // Read-only SD card (to save over 2K of flash)
 
+  /**
+   * SDIO Read-Ahead
+   * While a file is read sequentially, fetch the next blocks in the background
+   * with a multi-block read (CMD18) into a ring of block buffers. Reading the
+   * next block then rarely waits on the card. Helps most with slow cards or a
+   * low SDIO_CLOCK. STM32F1 SDIO only. Ignored with an SPI SD card.
+   * EXPERIMENTAL: Not yet tested with a real card.
+   */
+  //#define SDIO_READ_AHEAD
+  #if ENABLED(SDIO_READ_AHEAD)
+    #define SDIO_READ_AHEAD_BLOCKS 4        // Blocks in the ring (even). Uses 512 bytes of RAM per block.
+  #endif
+
+  /**
+   * SD Bulk Read
+   * Read the file being printed a chunk at a time and pull whole lines out of
+   * the chunk (memchr for the end-of-line) instead of fetching every byte with
+   * its own file read. Comments and '*' checksums are dropped in the same pass.
+   * Chunks are block-aligned so a full chunk bypasses the volume cache.
+   */
+  #define SD_BULK_READ
+  #if ENABLED(SD_BULK_READ)
+    #define SD_BULK_READ_SIZE 512           // Bytes of RAM. A power of 2 from 32 to 512.
+  #endif
+
   #define SD_PROCEDURE_DEPTH 1              // Increase if you need more nested M32 calls
 
   #define SD_FINISHED_STEPPERRELEASE true   // Disable steppers when SD Print is finished
@@ -1342,6 +1400,21 @@
 
   // Add an optimized binary file transfer mode, initiated with 'M28 B1'
   //#define BINARY_FILE_TRANSFER
+  #if ENABLED(BINARY_FILE_TRANSFER)
+    /**
+     * Stream G-code over the binary protocol straight into the command queue.
+     * Each packet holds whole lines and gets a single "ok<sync>", so the host
+     * doesn't wait for an "ok" after every line. The host may send up to
+     * BINARY_STREAM_WINDOW packets before the oldest is acknowledged. The
+     * serial RX buffer has to hold that many packets, so set RX_BUFFER_SIZE
+     * to at least BINARY_STREAM_WINDOW * (BINARY_STREAM_PACKET_SIZE + 10).
+     */
+    //#define BINARY_GCODE_STREAM
+    #if ENABLED(BINARY_GCODE_STREAM)
+      #define BINARY_STREAM_PACKET_SIZE 512   // (bytes) Largest packet payload, also for file transfer
+      #define BINARY_STREAM_WINDOW        2   // Packets in flight
+    #endif
+  #endif
 
   /**
    * Set this option to one of the following (or the board's defaults apply):
@@ -1815,6 +1888,26 @@
   //#define ARC_P_CIRCLES           // Enable the 'P' parameter to specify complete circles
   //#define CNC_WORKSPACE_PLANES    // Allow G2/G3 to operate in XY, ZX, or YZ planes
   //#define SF_ARC_FIX              // Enable only if using SkeinForge with "Arc Point" fillet procedure
+
+  /**
+   * Expand G2/G3 a few segments at a time from the main loop instead of
+   * blocking until the whole arc is planned. Serial/SD reading, the UI and
+   * heater management keep running during long arcs. The next command waits
+   * until the arc is fully planned.
+   *
+   * Segment length follows ARC_CHORD_ERROR, so large radii get fewer, longer
+   * segments. With ARC_SEGMENTS_PER_SEC the segments also get longer at high
+   * feedrates so the planner is never flooded.
+   *
+   * Until the arc is fully planned current_position stays at the arc start,
+   * so the UI, power-loss recovery and SD print end see the old position.
+   */
+  //#define ARC_STREAMING
+  #if ENABLED(ARC_STREAMING)
+    #define ARC_CHORD_ERROR  0.005  // (mm) Largest distance between a segment and the true arc
+    #define MIN_ARC_SEGMENT_MM 0.1  // (mm) Shortest segment
+    #define MAX_ARC_SEGMENT_MM   2  // (mm) Longest segment
+  #endif
 #endif
 
 // Support for G5 with XYZE destination and IJPQ offsets. Requires ~2666 bytes.
@@ -1914,7 +2007,20 @@
 
 // The ASCII buffer for serial input
 #define MAX_CMD_SIZE 96
-#define BUFSIZE 4
+#define BUFSIZE 16
+
+/**
+ * Packed Command Queue
+ * Store queued commands end to end in a single ring of PACKED_QUEUE_BYTES
+ * instead of BUFSIZE slots of MAX_CMD_SIZE bytes each. A short move only takes
+ * its own length, so the same RAM holds several times more commands and the
+ * planner stays fed through bursts of short moves.
+ * BUFSIZE is then the most commands that can be queued.
+ */
+#define PACKED_COMMAND_QUEUE
+#if ENABLED(PACKED_COMMAND_QUEUE)
+  #define PACKED_QUEUE_BYTES 384            // Bytes of command text. At least 2 * MAX_CMD_SIZE.
+#endif
 
 // Transmission to Host Buffer Size
 // To save 386 bytes of PROGMEM (and TX_BUFFER_SIZE+3 bytes of RAM) set to 0.
@@ -1928,6 +2034,9 @@
 // Host Receive Buffer Size
 // Without XON/XOFF flow control (see SERIAL_XON_XOFF below) 32 bytes should be enough.
 // To use flow control, set this buffer size to at least 1024 bytes.
+// STM32F1 host UARTs use this size when it's over the framework's 64 bytes.
+// With ADVANCED_OK the B credit is limited to the MAX_CMD_SIZE lines that fit
+// in this buffer, so a bigger buffer lets the host keep more lines in flight.
 // :[0, 2, 4, 8, 16, 32, 64, 128, 256, 512, 1024, 2048]
 //#define RX_BUFFER_SIZE 1024
 
@@ -1937,6 +2046,24 @@
   //#define SERIAL_XON_XOFF
 #endif
 
+/**
+ * Serial DMA
+ *
+ * STM32F1 host UARTs receive into the RX_BUFFER_SIZE ring by circular DMA,
+ * so a fast host no longer costs an interrupt per byte. The line-idle
+ * interrupt passes new bytes to the EMERGENCY_PARSER.
+ * Host USART1-3 also send by DMA from a ring of SERIAL_DMA_TX_SIZE, so
+ * output only waits when the ring is full. Periodic reports (auto-report,
+ * busy) are put off to a later loop instead of waiting for room.
+ * USART1 and USART3 share their DMA channels with SPI2 and SPI1, which
+ * then fall back to polled transfers. UART5 has no DMA and is unchanged.
+ * Also emulated by HAL/LINUX (see D115).
+ */
+//#define SERIAL_DMA
+#if ENABLED(SERIAL_DMA)
+  #define SERIAL_DMA_TX_SIZE 256  // Power of 2. 0 to keep the interrupt-driven output.
+#endif
+
 // Add M575 G-code to change the baud rate
 //#define BAUD_RATE_GCODE
 
@@ -1960,13 +2087,31 @@
  */
 //#define EMERGENCY_PARSER
 
+/**
+ * MeatPack G-code compression
+ *
+ * Accept G-code packed two characters to a byte by a host plugin,
+ * cutting serial traffic by about 40%. The host turns packing on and
+ * off with 0xFF 0xFF <cmd>, so plain G-code still works.
+ * Reported as MEATPACK in the M115 capabilities.
+ * NOTE: EMERGENCY_PARSER only sees plain bytes, so send M108/M112/M410
+ *       with packing off.
+ */
+//#define MEATPACK
+
 // Bad Serial-connections can miss a received command by sending an 'ok'
 // Therefore some clients abort after 30 seconds in a timeout.
 // Some other clients start sending commands while receiving a 'wait'.
 // This "wait" is only sent when the buffer is empty. 1 second is a good value here.
 //#define NO_TIMEOUTS 1000 // Milliseconds
 
-// Some clients will have this feature soon. This could make the NO_TIMEOUTS unnecessary.
+/**
+ * Advanced OK
+ * Add the line number and the free planner blocks (P) and queue slots (B)
+ * to each "ok", so the host can send lines ahead instead of waiting for
+ * each "ok". After a "Resend:" the lines already sent are dropped quietly
+ * until the requested line arrives. This could make NO_TIMEOUTS unnecessary.
+ */
 //#define ADVANCED_OK
 
 // Printrun may have trouble receiving long strings all at once.
@@ -3199,6 +3344,13 @@
 
 //#define GCODE_CASE_INSENSITIVE  // Accept G-code sent to the firmware in lowercase
 
+/**
+ * Convert G-code values with a small decimal parser instead of strtod().
+ * Only [-+]digits[.digits] is accepted (no exponent or hex). 9 significant
+ * digits are kept, so the result is within 2 float ULP of strtod().
+ */
+#define GCODE_FAST_DECIMAL
+
 //#define REPETIER_GCODE_M360     // Add commands originally from Repetier FW
 
 /**
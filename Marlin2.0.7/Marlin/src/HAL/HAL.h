@@ -42,6 +42,11 @@
   #define S_FMT "%s"
 #endif
 
+// Host-side pipeline timing, e.g., HAL_BENCH(PARSE)
+#ifndef HAL_BENCH
+  #define HAL_BENCH(P) NOOP
+#endif
+
 // String helper
 #ifndef PGMSTR
   #define PGMSTR(NAM,STR) const char NAM[] = STR
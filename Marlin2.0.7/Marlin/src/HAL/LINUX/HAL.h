@@ -50,6 +50,7 @@ uint8_t _getc();
 #define B10 2
 
 #include "hardware/Clock.h"
+#include "hardware/HostBench.h"
 
 #include "../shared/Marduino.h"
 #include "../shared/math_32bit.h"
@@ -60,6 +61,9 @@ uint8_t _getc();
 
 #define SHARED_SERVOS HAS_SERVOS
 
+// Host throughput accounting (see HostBench.h)
+#define HAL_BENCH(P) HostBench::Scope _bench_scope(HostBench::P)
+
 extern HalSerial usb_serial;
 #define MYSERIAL0 usb_serial
 
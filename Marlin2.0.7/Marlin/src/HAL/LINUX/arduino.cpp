@@ -24,6 +24,7 @@
 #include <iostream>
 #include "../../inc/MarlinConfig.h"
 #include "hardware/Clock.h"
+#include "hardware/Scheduler.h"
 #include "../shared/Delay.h"
 
 // Interrupts
@@ -36,9 +37,14 @@ void _delay_ms(const int delay_ms) {
 }
 
 uint32_t millis() {
+  Scheduler::poll(); // Virtual time: busy-waits on millis() must still move the clock
   return (uint32_t)Clock::millis();
 }
 
+uint32_t micros() {
+  return (uint32_t)Clock::micros();
+}
+
 // This is required for some Arduino libraries we are using
 void delayMicroseconds(uint32_t us) {
   Clock::delayMicros(us);
@@ -0,0 +1,56 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifdef __PLAT_LINUX__
+
+#include "HostBench.h"
+
+bool HostBench::enabled = false;
+HostBench::Stats HostBench::stats[HostBench::PHASE_COUNT] = {};
+HostBench::Phase HostBench::current = HostBench::NONE;
+uint64_t HostBench::mark = 0;
+
+void HostBench::reset() {
+  for (uint8_t i = 0; i < PHASE_COUNT; i++) stats[i] = {};
+}
+
+void HostBench::report(FILE *out) {
+  static const char * const names[PHASE_COUNT] = { "", "parse", "motion", "populate", "recalculate", "wait", "simulation" };
+
+  fprintf(out, "Pipeline          calls     total ms     avg ns     max ns\n");
+  uint64_t busy_ns = 0;
+  for (uint8_t i = PARSE; i < PHASE_COUNT; i++) {
+    const Stats &s = stats[i];
+    fprintf(out, "%-12s %10llu %12.3f %10llu %10llu\n", names[i], (unsigned long long)s.calls, s.self_ns / 1e6,
+      (unsigned long long)(s.calls ? s.self_ns / s.calls : 0), (unsigned long long)s.max_ns);
+    if (i < WAIT) busy_ns += s.self_ns;
+  }
+
+  // Blocks the pipeline could absorb per second if it never had to wait for the steppers
+  const uint64_t blocks = stats[POPULATE].calls;
+  fprintf(out, "Blocks: %llu, pipeline %.3f ms, %.0f blocks/s (planner only %.0f blocks/s)\n",
+    (unsigned long long)blocks, busy_ns / 1e6,
+    busy_ns ? blocks * 1e9 / busy_ns : 0.0,
+    (stats[POPULATE].self_ns + stats[RECALCULATE].self_ns) ? blocks * 1e9 / (stats[POPULATE].self_ns + stats[RECALCULATE].self_ns) : 0.0
+  );
+}
+
+#endif // __PLAT_LINUX__
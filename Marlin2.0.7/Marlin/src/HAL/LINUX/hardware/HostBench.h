@@ -0,0 +1,93 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+#include <chrono>
+
+/**
+ * Host-side throughput accounting for the G-code -> planner pipeline.
+ *
+ * Firmware code marks its hot paths with HAL_BENCH(phase). Each scope is timed
+ * on the host's steady clock (virtual time stands still while the firmware
+ * computes) and charged exclusively: time spent in a nested scope goes to the
+ * inner phase only, so "motion" is segmentation and kinematics without the
+ * planner work it triggers. Waits for a free block and the simulated ISRs that
+ * run whenever the firmware polls the clock are kept apart. The max column is
+ * the longest single call, nested scopes included.
+ */
+class HostBench {
+public:
+  enum Phase : uint8_t {
+    NONE,
+    PARSE,        // GCodeParser::parse
+    MOTION,       // prepare_line_to_destination, plan_arc (segmentation, kinematics, buffer_line)
+    POPULATE,     // Planner::_populate_block
+    RECALCULATE,  // Planner::recalculate
+    WAIT,         // Waiting for a free planner block
+    SIMULATION,   // Timer ISRs and host tasks dispatched by the Scheduler
+    PHASE_COUNT
+  };
+
+  struct Stats {
+    uint64_t calls, self_ns, max_ns;
+  };
+
+  static bool enabled;
+  static Stats stats[PHASE_COUNT];
+
+  static uint64_t now() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+  }
+
+  class Scope {
+  public:
+    Scope(const Phase p) : phase(p), parent(current) {
+      if (!enabled) return;
+      const uint64_t t = now();
+      if (parent != NONE) stats[parent].self_ns += t - mark; // Close the parent's running slice
+      current = phase;
+      start = mark = t;
+    }
+    ~Scope() {
+      if (!enabled || current != phase) return;
+      const uint64_t t = now();
+      Stats &s = stats[phase];
+      s.calls++;
+      s.self_ns += t - mark;
+      if (t - start > s.max_ns) s.max_ns = t - start;
+      current = parent;
+      mark = t; // The parent resumes here
+    }
+  private:
+    const Phase phase, parent;
+    uint64_t start;
+  };
+
+  static void reset();
+  static void report(FILE *out);
+
+private:
+  static Phase current;
+  static uint64_t mark;
+};
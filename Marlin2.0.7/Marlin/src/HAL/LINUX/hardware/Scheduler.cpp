@@ -0,0 +1,101 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifdef __PLAT_LINUX__
+
+#include "Scheduler.h"
+#include "Timer.h"
+#include "HostBench.h"
+
+Timer* Scheduler::timers[Scheduler::max_timers] = {};
+uint8_t Scheduler::timer_count = 0;
+Scheduler::Task Scheduler::tasks[Scheduler::max_tasks] = {};
+uint8_t Scheduler::task_count = 0;
+bool Scheduler::in_isr = false;
+bool Scheduler::in_task = false;
+uint64_t Scheduler::isr_cost = 0;
+uint64_t Scheduler::poll_cost = 1000;
+
+void Scheduler::attach(Timer *timer) {
+  if (timer_count < max_timers) timers[timer_count++] = timer;
+}
+
+void Scheduler::every(uint64_t period_ns, task_fn *fn) {
+  if (task_count < max_tasks) tasks[task_count++] = { fn, period_ns, Clock::nanos() + period_ns };
+}
+
+void Scheduler::runTasks(const uint64_t until) {
+  if (in_task) return;
+  in_task = true;
+  for (uint8_t i = 0; i < task_count; i++)
+    while (tasks[i].next <= until) {
+      HostBench::Scope bench(HostBench::SIMULATION);
+      tasks[i].fn();
+      tasks[i].next += tasks[i].period;
+    }
+  in_task = false;
+}
+
+void Scheduler::runUntil(uint64_t ns) {
+  // An ISR that waits (or polls the clock) just burns its own time. Nothing
+  // preempts it, but host tasks still run so serial output can drain.
+  if (in_isr) {
+    runTasks(ns);
+    if (ns > Clock::nanos()) Clock::setVirtualNanos(ns);
+    return;
+  }
+
+  for (;;) {
+    // Earliest enabled timer that falls due before 'ns'. Ties go to the lower timer index.
+    Timer *next = nullptr;
+    for (uint8_t i = 0; i < timer_count; i++) {
+      Timer * const t = timers[i];
+      if (t->enabled() && t->nextFire() <= ns && (!next || t->nextFire() < next->nextFire()))
+        next = t;
+    }
+    if (!next) break;
+
+    const uint64_t due = next->nextFire();
+    runTasks(due);
+    if (due > Clock::nanos()) Clock::setVirtualNanos(due);
+
+    in_isr = true;
+    {
+      HostBench::Scope bench(HostBench::SIMULATION);
+      next->fire();
+    }
+    Clock::setVirtualNanos(Clock::nanos() + isr_cost);
+    in_isr = false;
+  }
+
+  runTasks(ns);
+  if (ns > Clock::nanos()) Clock::setVirtualNanos(ns);
+}
+
+void Scheduler::advance(uint64_t ns) {
+  runUntil(Clock::nanos() + ns);
+}
+
+void Scheduler::poll() {
+  if (Clock::isVirtual()) advance(poll_cost);
+}
+
+#endif // __PLAT_LINUX__
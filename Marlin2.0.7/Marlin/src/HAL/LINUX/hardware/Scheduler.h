@@ -0,0 +1,74 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+#include <stdint.h>
+
+class Timer;
+
+/**
+ * Deterministic virtual-time scheduler
+ *
+ * When Clock is in virtual mode nothing sleeps and no thread runs beside the
+ * main loop. Time only moves forward when firmware code waits (delay, busy
+ * polls of millis) and every due Timer ISR or host task is dispatched from
+ * here, in timestamp order, so a replayed G-code file always yields the same
+ * trace.
+ */
+class Scheduler {
+public:
+  typedef void (task_fn)();
+
+  static constexpr uint8_t max_timers = 4, max_tasks = 8;
+
+  // Hardware timers register themselves on init() when virtual time is active
+  static void attach(Timer *timer);
+
+  // Periodic host-side work (serial pump, peripheral models). Runs "outside" the MCU, costs no time.
+  static void every(uint64_t period_ns, task_fn *fn);
+
+  // Advance the clock to 'ns', firing everything that falls due on the way
+  static void runUntil(uint64_t ns);
+  static void advance(uint64_t ns);
+
+  // Charge one busy-poll of the clock so wait loops make progress
+  static void poll();
+
+  static bool inISR() { return in_isr; }
+
+  static uint64_t isr_cost;   // Virtual time consumed by each timer ISR
+  static uint64_t poll_cost;  // Virtual time consumed by each poll()
+
+private:
+  struct Task {
+    task_fn *fn;
+    uint64_t period, next;
+  };
+
+  static Timer *timers[max_timers];
+  static uint8_t timer_count;
+  static Task tasks[max_tasks];
+  static uint8_t task_count;
+  static bool in_isr, in_task;
+
+  static void runTasks(const uint64_t until);
+};
@@ -0,0 +1,65 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifdef __PLAT_LINUX__
+
+#include <stdio.h>
+#include "StepLoggerCSV.h"
+
+StepLoggerCSV::StepLoggerCSV(std::string filename) {
+  axis_count = 0;
+  if (filename.length()) file.open(filename);
+}
+
+StepLoggerCSV::~StepLoggerCSV() {
+  if (file.is_open()) file.close();
+}
+
+void StepLoggerCSV::watch(char axis, pin_type step, pin_type dir) {
+  if (axis_count < max_axes && Gpio::valid_pin(step))
+    axes[axis_count++] = { axis, step, dir, 0, 0, UINT64_MAX };
+}
+
+void StepLoggerCSV::log(GpioEvent ev) {
+  if (ev.event != GpioEvent::RISE) return;
+  for (uint8_t i = 0; i < axis_count; i++) {
+    Axis &a = axes[i];
+    if (ev.pin_id != a.step_pin) continue;
+    if (a.steps && ev.timestamp - a.last < a.min_interval) a.min_interval = ev.timestamp - a.last;
+    a.last = ev.timestamp;
+    a.steps++;
+    if (file.is_open()) file << ev.timestamp << ", " << a.name << ", " << Gpio::get(a.dir_pin) << '\n';
+    return;
+  }
+}
+
+void StepLoggerCSV::report(FILE *out) {
+  for (uint8_t i = 0; i < axis_count; i++) {
+    const Axis &a = axes[i];
+    fprintf(out, "%c: %llu steps", a.name, (unsigned long long)a.steps);
+    if (a.steps > 1 && a.min_interval)
+      fprintf(out, ", min interval %llu ns (%llu steps/s peak)", (unsigned long long)a.min_interval, 1000000000ULL / a.min_interval);
+    fputc('\n', out);
+  }
+  if (file.is_open()) file.flush();
+}
+
+#endif // __PLAT_LINUX__
@@ -0,0 +1,53 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+#include <fstream>
+#include "Gpio.h"
+
+/**
+ * Per-step timestamp trace for virtual-time runs.
+ * Logs every rising edge on a watched STEP pin as "timestamp_ns, axis, dir"
+ * and keeps the shortest step interval seen so the step-rate ceiling can be read
+ * straight from the run summary.
+ */
+class StepLoggerCSV: public IOLogger {
+public:
+  static constexpr uint8_t max_axes = 8;
+
+  StepLoggerCSV(std::string filename);
+  virtual ~StepLoggerCSV();
+  void watch(char axis, pin_type step, pin_type dir);
+  void log(GpioEvent ev);
+  void report(FILE *out);
+
+private:
+  struct Axis {
+    char name;
+    pin_type step_pin, dir_pin;
+    uint64_t steps, last, min_interval;
+  };
+
+  std::ofstream file;
+  Axis axes[max_axes];
+  uint8_t axis_count;
+};
@@ -22,6 +22,7 @@
 #ifdef __PLAT_LINUX__
 
 #include "Timer.h"
+#include "Scheduler.h"
 #include <stdio.h>
 
 Timer::Timer() {
@@ -34,10 +35,14 @@ Timer::Timer() {
   period = 0;
   start_time = 0;
   avg_error = 0;
+  next_fire = UINT64_MAX;
+  fires = 0;
+  max_latency = 0;
+  total_latency = 0;
 }
 
 Timer::~Timer() {
-  timer_delete(timerid);
+  if (!Clock::isVirtual()) timer_delete(timerid);
 }
 
 void Timer::init(uint32_t sig_id, uint32_t sim_freq, callback_fn* fn) {
@@ -47,6 +52,11 @@ void Timer::init(uint32_t sig_id, uint32_t sim_freq, callback_fn* fn) {
   frequency = sim_freq;
   cbfn = fn;
 
+  if (Clock::isVirtual()) {
+    Scheduler::attach(this);
+    return;
+  }
+
   sa.sa_flags = SA_SIGINFO;
   sa.sa_sigaction = Timer::handler;
   sigemptyset(&sa.sa_mask);
@@ -68,11 +78,13 @@ void Timer::init(uint32_t sig_id, uint32_t sim_freq, callback_fn* fn) {
 }
 
 void Timer::start(uint32_t frequency) {
+  if (Clock::isVirtual()) start_time = Clock::nanos();
   setCompare(this->frequency / frequency);
   //printf("timer(%ld) started\n", getID());
 }
 
 void Timer::enable() {
+  if (Clock::isVirtual()) { active = true; return; }
   if (sigprocmask(SIG_UNBLOCK, &mask, nullptr) == -1) {
     return; // todo: handle error
   }
@@ -81,6 +93,7 @@ void Timer::enable() {
 }
 
 void Timer::disable() {
+  if (Clock::isVirtual()) { active = false; return; }
   if (sigprocmask(SIG_SETMASK, &mask, nullptr) == -1) {
     return; // todo: handle error
   }
@@ -88,6 +101,13 @@ void Timer::disable() {
 }
 
 void Timer::setCompare(uint32_t compare) {
+  if (Clock::isVirtual()) {
+    // Compare counts from the start of the current period, like the hardware counter
+    this->compare = compare;
+    next_fire = start_time + Clock::ticksToNanos(compare ? compare : 1, frequency);
+    return;
+  }
+
   uint32_t nsec_offset = 0;
   if (active) {
     nsec_offset = Clock::nanos() - this->start_time; // calculate how long the timer would have been running for
@@ -111,7 +131,21 @@ void Timer::setCompare(uint32_t compare) {
 }
 
 uint32_t Timer::getCount() {
+  Scheduler::poll(); // Busy-waits on the counter must let virtual time pass
   return Clock::nanosToTicks(Clock::nanos() - this->start_time, frequency);
 }
 
+// Called by the Scheduler once virtual time reaches next_fire
+void Timer::fire() {
+  const uint64_t now = Clock::nanos(), latency = now - next_fire;
+  fires++;
+  total_latency += latency;
+  if (latency > max_latency) max_latency = latency;
+  if (period && latency > period) overruns++; // No period before the first fire
+  start_time = now;
+  period = Clock::ticksToNanos(compare ? compare : 1, frequency);
+  next_fire = start_time + period;
+  cbfn();
+}
+
 #endif // __PLAT_LINUX__
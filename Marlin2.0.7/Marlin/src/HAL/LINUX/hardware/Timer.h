@@ -48,6 +48,13 @@ public:
   uint32_t getOverruns() {return overruns;}
   uint32_t getAvgError() {return avg_error;}
 
+  // Virtual time (see Scheduler)
+  uint64_t nextFire() {return next_fire;}
+  void fire();
+  uint64_t getFires() {return fires;}
+  uint64_t getMaxLatency() {return max_latency;}
+  uint64_t getAvgLatency() {return fires ? total_latency / fires : 0;}
+
   intptr_t getID() {
     return (*(intptr_t*)timerid);
   }
@@ -73,4 +80,8 @@ private:
   uint64_t period;
   uint64_t avg_error;
   uint64_t start_time;
+  uint64_t next_fire;
+  uint64_t fires;
+  uint64_t max_latency;
+  uint64_t total_latency;
 };
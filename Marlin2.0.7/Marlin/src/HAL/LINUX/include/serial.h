@@ -25,10 +25,15 @@
 #if ENABLED(EMERGENCY_PARSER)
   #include "../../../feature/e_parser.h"
 #endif
+#if ENABLED(SERIAL_DMA)
+  #include "../../shared/DmaRxRing.h"
+#endif
 
 #include <stdarg.h>
 #include <stdio.h>
 
+#include "../hardware/Scheduler.h"
+
 /**
  * Generic RingBuffer
  * T type of the buffer array
@@ -87,26 +92,69 @@ public:
 
   void end() {}
 
-  int peek() {
-    uint8_t value;
-    return receive_buffer.peek(&value) ? value : -1;
-  }
+  #if ENABLED(SERIAL_DMA)
+
+    /**
+     * Emulated circular RX DMA. rx_put() is the UART and DMA channel: it stores
+     * each byte and counts down like CNDTR, with no regard for the reader.
+     * rx_idle() is the idle-line interrupt that feeds the emergency parser.
+     */
+    volatile uint8_t rx_dma_buffer[RX_BUFFER_SIZE];
+    volatile uint16_t rx_dma_count = RX_BUFFER_SIZE;
+    DmaRxRing<RX_BUFFER_SIZE> rx_ring;
+    uint32_t rx_idle_bytes = 0;   // Bytes seen by rx_idle(), for the D115 check
+    bool loopback = false;        // Send write() back into the receiver
+
+    void rx_put(const uint8_t c) {
+      rx_dma_buffer[RX_BUFFER_SIZE - rx_dma_count] = c;
+      if (!--rx_dma_count) rx_dma_count = RX_BUFFER_SIZE;
+    }
+    // Keep one byte free so the emulated host never laps the reader
+    uint32_t rx_free() { return RX_BUFFER_SIZE - 1 - available(); }
+    void rx_idle() {
+      rx_idle_bytes += rx_ring.scan(rx_dma_buffer, rx_dma_count, [this](const uint8_t c) {
+        TERN(EMERGENCY_PARSER, emergency_parser.update(emergency_state, c), UNUSED(c));
+      });
+    }
+
+    int peek() { return rx_ring.peek(rx_dma_buffer, rx_dma_count); }
+    int read() { return rx_ring.read(rx_dma_buffer, rx_dma_count); }
+    uint16_t available() { return rx_ring.available(rx_dma_count); }
+    void flush() { rx_ring.flush(rx_dma_count); }
+
+  #else
+
+    void rx_put(const uint8_t c) { receive_buffer.write(c); }
+    uint32_t rx_free() { return receive_buffer.free(); }
+    void rx_idle() {}
 
-  int read() { return receive_buffer.read(); }
+    int peek() {
+      uint8_t value;
+      return receive_buffer.peek(&value) ? value : -1;
+    }
+
+    int read() { return receive_buffer.read(); }
+
+    uint16_t available() {
+      return (uint16_t)receive_buffer.available();
+    }
+
+    void flush() { receive_buffer.clear(); }
+
+  #endif
 
   size_t write(char c) {
+    #if ENABLED(SERIAL_DMA)
+      if (loopback) { rx_put(c); return 1; }
+    #endif
     if (!host_connected) return 0;
-    while (!transmit_buffer.free());
+    while (!transmit_buffer.free()) Scheduler::poll();
     return transmit_buffer.write(c);
   }
 
   operator bool() { return host_connected; }
 
-  uint16_t available() {
-    return (uint16_t)receive_buffer.available();
-  }
-
-  void flush() { receive_buffer.clear(); }
+  bool tx_room(const uint16_t n) { return transmit_buffer.free() >= _MIN(uint32_t(n), uint32_t(128)); }
 
   uint8_t availableForWrite() {
     return transmit_buffer.free() > 255 ? 255 : (uint8_t)transmit_buffer.free();
@@ -114,7 +162,7 @@ public:
 
   void flushTX() {
     if (host_connected)
-      while (transmit_buffer.available()) { /* nada */ }
+      while (transmit_buffer.available()) Scheduler::poll();
   }
 
   void printf(const char *format, ...) {
@@ -129,6 +177,8 @@ public:
           if (transmit_buffer.write(buffer[i])) {
             ++i;
           }
+          else
+            Scheduler::poll();
         }
       }
     }
@@ -202,7 +252,9 @@ public:
   void println(double value, int round = 6) { printf("%f\n" , value); }
   void println() { print('\n'); }
 
-  volatile RingBuffer<uint8_t, 128> receive_buffer;
+  #if DISABLED(SERIAL_DMA)
+    volatile RingBuffer<uint8_t, 128> receive_buffer;
+  #endif
   volatile RingBuffer<uint8_t, 128> transmit_buffer;
   volatile bool host_connected;
 };
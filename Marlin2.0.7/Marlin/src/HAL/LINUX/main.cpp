@@ -26,6 +26,7 @@ extern void loop();
 
 #include <iostream>
 #include <fstream>
+#include <getopt.h>
 
 #include "../../inc/MarlinConfig.h"
 #include <stdio.h>
@@ -33,7 +34,16 @@ extern void loop();
 #include "../shared/Delay.h"
 #include "hardware/IOLoggerCSV.h"
 #include "hardware/Heater.h"
+#include "hardware/HostBench.h"
 #include "hardware/LinearAxis.h"
+#include "hardware/Scheduler.h"
+#include "hardware/StepLoggerCSV.h"
+#include "hardware/Timer.h"
+
+#include "../../module/planner.h"
+#include "../../gcode/queue.h"
+
+extern Timer timers[2];
 
 // simple stdout / stdin implementation for fake serial port
 void write_serial_thread() {
@@ -48,10 +58,12 @@ void write_serial_thread() {
 void read_serial_thread() {
   char buffer[255] = {};
   for (;;) {
-    std::size_t len = _MIN(usb_serial.receive_buffer.free(), 254U);
-    if (fgets(buffer, len, stdin))
+    std::size_t len = _MIN(usb_serial.rx_free(), 254U);
+    if (fgets(buffer, len, stdin)) {
       for (std::size_t i = 0; i < strlen(buffer); i++)
-        usb_serial.receive_buffer.write(buffer[i]);
+        usb_serial.rx_put(buffer[i]);
+      usb_serial.rx_idle();
+    }
     std::this_thread::yield();
   }
 }
@@ -103,7 +115,161 @@ void simulation_loop() {
   }
 }
 
-int main() {
+/**
+ * Virtual time
+ *
+ * A single thread runs setup()/loop() and the Scheduler dispatches the stepper
+ * and temperature ISRs, the heater models and the serial pump against a
+ * simulated clock. The G-code replay is fed to the serial port as fast as the
+ * firmware reads it (an ideal host), so two runs of the same file give the
+ * same step trace.
+ */
+static FILE *replay_file = nullptr;
+static Heater *virtual_hotend, *virtual_bed;
+static StepLoggerCSV *step_logger;
+static uint32_t starvation_events = 0;
+static bool was_moving = false;
+
+static void virtual_serial_task() {
+  while (usb_serial.transmit_buffer.available())
+    fputc(usb_serial.transmit_buffer.read(), stdout);
+
+  while (replay_file && usb_serial.rx_free()) {
+    const int c = fgetc(replay_file);
+    if (c == EOF) {
+      if (replay_file != stdin) fclose(replay_file);
+      replay_file = nullptr;
+    }
+    else
+      usb_serial.rx_put(c);
+  }
+  usb_serial.rx_idle();
+}
+
+static void virtual_heater_task() {
+  virtual_hotend->update();
+  virtual_bed->update();
+}
+
+// The planner ran dry while there was still G-code to feed it
+static void virtual_motion_task() {
+  const bool moving = planner.has_blocks_queued();
+  if (was_moving && !moving && (replay_file || queue.length || usb_serial.available()))
+    starvation_events++;
+  was_moving = moving;
+}
+
+static bool virtual_done() {
+  return !replay_file && !usb_serial.available() && !queue.length && !planner.has_blocks_queued();
+}
+
+static int virtual_main(const char *replay, const char *trace, const double limit, const bool bench) {
+  if (replay) {
+    replay_file = fopen(replay, "r");
+    if (!replay_file) { perror(replay); return 1; }
+  }
+  else
+    replay_file = stdin;
+
+  Clock::setFrequency(F_CPU);
+  Clock::setVirtual(true);
+
+  Heater hotend(HEATER_0_PIN, TEMP_0_PIN);
+  Heater bed(HEATER_BED_PIN, TEMP_BED_PIN);
+  LinearAxis x_axis(X_ENABLE_PIN, X_DIR_PIN, X_STEP_PIN, X_MIN_PIN, X_MAX_PIN);
+  LinearAxis y_axis(Y_ENABLE_PIN, Y_DIR_PIN, Y_STEP_PIN, Y_MIN_PIN, Y_MAX_PIN);
+  LinearAxis z_axis(Z_ENABLE_PIN, Z_DIR_PIN, Z_STEP_PIN, Z_MIN_PIN, Z_MAX_PIN);
+  LinearAxis extruder0(E0_ENABLE_PIN, E0_DIR_PIN, E0_STEP_PIN, P_NC, P_NC);
+  virtual_hotend = &hotend;
+  virtual_bed = &bed;
+
+  StepLoggerCSV logger(trace ? trace : "");
+  logger.watch('X', X_STEP_PIN, X_DIR_PIN);
+  logger.watch('Y', Y_STEP_PIN, Y_DIR_PIN);
+  logger.watch('Z', Z_STEP_PIN, Z_DIR_PIN);
+  logger.watch('E', E0_STEP_PIN, E0_DIR_PIN);
+  Gpio::attachLogger(&logger);
+  step_logger = &logger;
+
+  Scheduler::every(10000, virtual_serial_task);     // 10µs: faster than 250000 baud
+  Scheduler::every(100000, virtual_motion_task);    // 100µs
+  Scheduler::every(1000000, virtual_heater_task);   // 1ms
+
+  MYSERIAL0.begin(BAUDRATE);
+  HAL_timer_init();
+
+  setup();
+  HostBench::enabled = bench;
+  const uint64_t wall_start = HostBench::now();
+  const uint64_t limit_ns = limit > 0 ? uint64_t(limit * 1000000000.0) : UINT64_MAX;
+  while (!virtual_done() && Clock::nanos() < limit_ns) {
+    loop();
+    Scheduler::poll();
+  }
+  HostBench::enabled = false;
+  virtual_serial_task();
+  fflush(stdout);
+
+  fprintf(stderr, "\nVirtual time: %.6f s\n", Clock::seconds());
+  step_logger->report(stderr);
+  fprintf(stderr, "Planner starvation events: %u\n", starvation_events);
+  for (uint8_t i = 0; i < COUNT(timers); i++)
+    fprintf(stderr, "Timer %u: %llu ISRs, latency avg %llu ns max %llu ns, %u overruns\n", i,
+      (unsigned long long)timers[i].getFires(), (unsigned long long)timers[i].getAvgLatency(),
+      (unsigned long long)timers[i].getMaxLatency(), timers[i].getOverruns()
+    );
+  if (bench) {
+    fprintf(stderr, "Host time: %.3f s\n", (HostBench::now() - wall_start) / 1e9);
+    HostBench::report(stderr);
+  }
+
+  Gpio::attachLogger(nullptr);
+  return 0;
+}
+
+static void usage(const char *name) {
+  fprintf(stderr,
+    "Usage: %s [options]\n"
+    "  -v, --virtual        Deterministic single-threaded virtual time (G-code from stdin)\n"
+    "  -r, --replay FILE    Replay a G-code file in virtual time\n"
+    "  -t, --trace FILE     Write a per-step timestamp trace (CSV)\n"
+    "  -i, --isr-cost NS    Virtual time consumed by each timer ISR (default 0)\n"
+    "  -p, --poll-cost NS   Virtual time consumed by each clock poll (default 1000)\n"
+    "  -l, --limit SECONDS  Stop after this much virtual time\n"
+    "  -b, --bench          Time the parser, motion and planner on the host and report blocks/s\n", name
+  );
+}
+
+int main(int argc, char *argv[]) {
+  static const struct option long_options[] = {
+    { "virtual",   no_argument,       nullptr, 'v' },
+    { "replay",    required_argument, nullptr, 'r' },
+    { "trace",     required_argument, nullptr, 't' },
+    { "isr-cost",  required_argument, nullptr, 'i' },
+    { "poll-cost", required_argument, nullptr, 'p' },
+    { "limit",     required_argument, nullptr, 'l' },
+    { "bench",     no_argument,       nullptr, 'b' },
+    { nullptr, 0, nullptr, 0 }
+  };
+
+  bool virtual_time = false, bench = false;
+  const char *replay = nullptr, *trace = nullptr;
+  double limit = 0;
+  for (int opt; (opt = getopt_long(argc, argv, "vr:t:i:p:l:b", long_options, nullptr)) != -1;) {
+    switch (opt) {
+      case 'v': virtual_time = true; break;
+      case 'r': virtual_time = true; replay = optarg; break;
+      case 't': trace = optarg; break;
+      case 'i': Scheduler::isr_cost = strtoull(optarg, nullptr, 10); break;
+      case 'p': Scheduler::poll_cost = _MAX(1ULL, strtoull(optarg, nullptr, 10)); break;
+      case 'l': limit = atof(optarg); break;
+      case 'b': virtual_time = true; bench = true; break;
+      default: usage(argv[0]); return 1;
+    }
+  }
+
+  if (virtual_time) return virtual_main(replay, trace, limit, bench);
+
   std::thread write_serial (write_serial_thread);
   std::thread read_serial (read_serial_thread);
 
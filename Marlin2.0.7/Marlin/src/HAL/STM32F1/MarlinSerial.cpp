@@ -65,6 +65,15 @@ static inline __always_inline void my_usart_irq(ring_buffer *rb, ring_buffer *wb
     regs->DR;
   }
 
+  #if ENABLED(SERIAL_DMA)
+    // The DMA took the bytes and the line has gone quiet. Reading SR then DR
+    // clears IDLE. Hand the new bytes to the emergency parser.
+    if ((cr1its & USART_CR1_IDLEIE) && (srflags & USART_SR_IDLE)) {
+      regs->DR;
+      serial.rx_idle();
+    }
+  #endif
+
   // TXE signifies readiness to send a byte to DR.
   if ((cr1its & USART_CR1_TXEIE) && (srflags & USART_SR_TXE)) {
     if (!rb_is_empty(wb))
@@ -90,11 +99,85 @@ constexpr bool serial_handles_emergency(int port) {
   ;
 }
 
+// Host ports get an RX buffer of RX_BUFFER_SIZE when it's bigger than the
+// framework's. A host that keeps several lines in flight (ADVANCED_OK)
+// can then send more before the first "ok" comes back.
+// With SERIAL_DMA the buffer is always used, as the DMA's ring.
+#if RX_BUFFER_SIZE > USART_RX_BUF_SIZE || ENABLED(SERIAL_DMA)
+  #define HOST_RX_BUFFERS 1
+  #if defined(SERIAL_PORT) && SERIAL_PORT > 0
+    static uint8_t host_rx_buffer_1[RX_BUFFER_SIZE];
+  #endif
+  #if defined(SERIAL_PORT_2) && SERIAL_PORT_2 > 0
+    static uint8_t host_rx_buffer_2[RX_BUFFER_SIZE];
+  #endif
+#endif
+
+constexpr uint8_t* host_rx_buffer(int port) {
+  return
+    #if HOST_RX_BUFFERS
+      #if defined(SERIAL_PORT) && SERIAL_PORT > 0
+        (SERIAL_PORT) == port ? host_rx_buffer_1 :
+      #endif
+      #if defined(SERIAL_PORT_2) && SERIAL_PORT_2 > 0
+        (SERIAL_PORT_2) == port ? host_rx_buffer_2 :
+      #endif
+    #endif
+    nullptr;
+}
+
+#if ENABLED(SERIAL_DMA)
+  // The DMA channel wired to each UART's receiver. UART5 has none.
+  static dma_dev* rx_dma_dev(int port) {
+    switch (port) {
+      case 1: case 2: case 3: return DMA1;
+      #if EITHER(STM32_HIGH_DENSITY, STM32_XL_DENSITY)
+        case 4: return DMA2;
+      #endif
+      default: return nullptr;
+    }
+  }
+  constexpr dma_channel rx_dma_channel(int port) {
+    return port == 1 ? DMA_CH5 : port == 2 ? DMA_CH6 : DMA_CH3;
+  }
+
+  #if HAS_SERIAL_DMA_TX
+    // Host USART1-3 send by DMA. UART4's TX channel (DMA2 channel 5) is the FSMC display's.
+    #if WITHIN(SERIAL_PORT, 1, 3)
+      static uint8_t host_tx_buffer_1[SERIAL_DMA_TX_SIZE];
+    #endif
+    #if defined(SERIAL_PORT_2) && WITHIN(SERIAL_PORT_2, 1, 3)
+      static uint8_t host_tx_buffer_2[SERIAL_DMA_TX_SIZE];
+    #endif
+
+    constexpr uint8_t* host_tx_buffer(int port) {
+      return
+        #if WITHIN(SERIAL_PORT, 1, 3)
+          (SERIAL_PORT) == port ? host_tx_buffer_1 :
+        #endif
+        #if defined(SERIAL_PORT_2) && WITHIN(SERIAL_PORT_2, 1, 3)
+          (SERIAL_PORT_2) == port ? host_tx_buffer_2 :
+        #endif
+        nullptr;
+    }
+    static dma_dev* tx_dma_dev(int port) { return WITHIN(port, 1, 3) ? DMA1 : nullptr; }
+    constexpr dma_channel tx_dma_channel(int port) {
+      return port == 1 ? DMA_CH4 : port == 2 ? DMA_CH7 : DMA_CH2;
+    }
+    #define HOST_RX_ARGS(n) host_rx_buffer(n), rx_dma_dev(n), rx_dma_channel(n), host_tx_buffer(n), tx_dma_dev(n), tx_dma_channel(n)
+  #else
+    #define HOST_RX_ARGS(n) host_rx_buffer(n), rx_dma_dev(n), rx_dma_channel(n)
+  #endif
+#else
+  #define HOST_RX_ARGS(n) host_rx_buffer(n)
+#endif
+
 #define DEFINE_HWSERIAL_MARLIN(name, n)   \
   MarlinSerial name(USART##n,             \
             BOARD_USART##n##_TX_PIN,      \
             BOARD_USART##n##_RX_PIN,      \
-            serial_handles_emergency(n)); \
+            serial_handles_emergency(n),  \
+            HOST_RX_ARGS(n));             \
   extern "C" void __irq_usart##n(void) {  \
     my_usart_irq(USART##n->rb, USART##n->wb, USART##n##_BASE, MSerial##n); \
   }
@@ -103,7 +186,8 @@ constexpr bool serial_handles_emergency(int port) {
   MarlinSerial name(UART##n,                 \
           BOARD_USART##n##_TX_PIN,           \
           BOARD_USART##n##_RX_PIN,           \
-          serial_handles_emergency(n));      \
+          serial_handles_emergency(n),       \
+          HOST_RX_ARGS(n));                  \
   extern "C" void __irq_usart##n(void) {     \
     my_usart_irq(UART##n->rb, UART##n->wb, UART##n##_BASE, MSerial##n); \
   }
@@ -119,6 +203,104 @@ DEFINE_HWSERIAL_MARLIN(MSerial3, 3);
   DEFINE_HWSERIAL_UART_MARLIN(MSerial5, 5);
 #endif
 
+#if ENABLED(SERIAL_DMA)
+
+  #if HAS_SERIAL_DMA_TX
+
+    // One handler for every TX channel. A port with nothing finished returns at once.
+    static void serial_tx_dma_irq() {
+      MSerial1.tx_dma_service();
+      MSerial2.tx_dma_service();
+      MSerial3.tx_dma_service();
+    }
+
+    // Send the next contiguous run once the last one is done.
+    // Call from the DMA interrupt or with interrupts off.
+    void MarlinSerial::tx_dma_service() {
+      if (!tx_buffer) return;
+      // The count reaching zero marks the end. The TC flag isn't kept
+      // because libmaple clears it after the handler.
+      if (tx_sending) {
+        if (dma_channel_regs(tx_dma, tx_dma_channel)->CNDTR) return;
+        dma_disable(tx_dma, tx_dma_channel);
+        tx_tail = (tx_tail + tx_sending) & (SERIAL_DMA_TX_SIZE - 1);
+        tx_sending = 0;
+      }
+      const uint16_t h = tx_head, t = tx_tail;
+      if (h == t) return;
+      tx_sending = (h > t ? h : SERIAL_DMA_TX_SIZE) - t;
+      dma_set_mem_addr(tx_dma, tx_dma_channel, tx_buffer + t);
+      dma_set_num_transfers(tx_dma, tx_dma_channel, tx_sending);
+      dma_enable(tx_dma, tx_dma_channel);
+    }
+
+    size_t MarlinSerial::write(uint8_t c) {
+      if (!tx_buffer) return HardwareSerial::write(c);
+      const uint16_t h = tx_head, next = (h + 1) & (SERIAL_DMA_TX_SIZE - 1);
+      while (next == tx_tail) {
+        // The ring is full. Wait for the DMA, which also works with interrupts off.
+        CRITICAL_SECTION_START();
+        tx_dma_service();
+        CRITICAL_SECTION_END();
+      }
+      tx_buffer[h] = c;
+      tx_head = next;
+      if (!tx_sending) {
+        CRITICAL_SECTION_START();
+        tx_dma_service();
+        CRITICAL_SECTION_END();
+      }
+      return 1;
+    }
+
+    void MarlinSerial::flush() {
+      if (tx_buffer) while (tx_head != tx_tail) {
+        CRITICAL_SECTION_START();
+        tx_dma_service();
+        CRITICAL_SECTION_END();
+      }
+      HardwareSerial::flush(); // Wait for the last byte to leave the shift register
+    }
+
+  #endif // HAS_SERIAL_DMA_TX
+
+  // Called by begin() with the UART interrupt off
+  void MarlinSerial::dma_begin() {
+    usart_dev * const dev = c_dev();
+    usart_reg_map * const regs = dev->regs;
+    if (rx_dma) {
+      // The DMA fills rx_buffer around and around. Take no RXNE interrupts,
+      // only the line-idle one when the emergency parser needs the bytes.
+      dma_init(rx_dma);
+      dma_setup_transfer(rx_dma, rx_dma_channel, &regs->DR, DMA_SIZE_8BITS, rx_buffer, DMA_SIZE_8BITS, DMA_MINC_MODE | DMA_CIRC_MODE);
+      dma_set_num_transfers(rx_dma, rx_dma_channel, RX_BUFFER_SIZE);
+      dma_set_priority(rx_dma, rx_dma_channel, DMA_PRIORITY_HIGH);
+      rx_ring.reset();
+      dma_enable(rx_dma, rx_dma_channel);
+      regs->CR3 |= USART_CR3_DMAR;
+      regs->CR1 &= ~USART_CR1_RXNEIE;
+      if (TERN0(EMERGENCY_PARSER, ep_enabled)) regs->CR1 |= USART_CR1_IDLEIE;
+    }
+    else
+      rb_init(dev->rb, RX_BUFFER_SIZE, rx_buffer);
+
+    #if HAS_SERIAL_DMA_TX
+      if (tx_buffer) {
+        // write() fills the ring and the DMA sends it. The USART's own TX
+        // interrupt and buffer are left idle.
+        dma_init(tx_dma);
+        dma_disable(tx_dma, tx_dma_channel);
+        dma_setup_transfer(tx_dma, tx_dma_channel, &regs->DR, DMA_SIZE_8BITS, tx_buffer, DMA_SIZE_8BITS, DMA_MINC_MODE | DMA_FROM_MEM | DMA_TRNS_CMPLT);
+        dma_set_priority(tx_dma, tx_dma_channel, DMA_PRIORITY_MEDIUM);
+        dma_attach_interrupt(tx_dma, tx_dma_channel, serial_tx_dma_irq);
+        tx_head = tx_tail = tx_sending = 0;
+        regs->CR3 |= USART_CR3_DMAT;
+      }
+    #endif
+  }
+
+#endif // SERIAL_DMA
+
 // Check the type of each serial port by passing it to a template function.
 // HardwareSerial is known to sometimes hang the controller when an error occurs,
 // so this case will fail the static assert. All other classes are assumed to be ok.
@@ -29,6 +29,10 @@
 #if ENABLED(EMERGENCY_PARSER)
   #include "../../feature/e_parser.h"
 #endif
+#if ENABLED(SERIAL_DMA)
+  #include <libmaple/dma.h>
+  #include "../shared/DmaRxRing.h"
+#endif
 
 // Increase priority of serial interrupts, to reduce overflow errors
 #define UART_IRQ_PRIO 1
@@ -41,25 +45,97 @@ public:
     inline bool emergency_parser_enabled() { return ep_enabled; }
   #endif
 
-  MarlinSerial(struct usart_dev *usart_device, uint8 tx_pin, uint8 rx_pin, bool TERN_(EMERGENCY_PARSER, ep_capable)) :
+  // A host port's RX buffer of RX_BUFFER_SIZE, replacing the framework's
+  // USART_RX_BUF_SIZE buffer, or nullptr to keep that one
+  uint8_t * const rx_buffer;
+
+  #if ENABLED(SERIAL_DMA)
+    // Circular DMA into rx_buffer, or nullptr for an RX interrupt per byte
+    dma_dev * const rx_dma;
+    const dma_channel rx_dma_channel;
+    DmaRxRing<RX_BUFFER_SIZE> rx_ring;
+
+    // The DMA's remaining count gives the head of the ring
+    inline uint16_t rx_dma_count() { return dma_channel_regs(rx_dma, rx_dma_channel)->CNDTR; }
+
+    int available() override { return rx_dma ? rx_ring.available(rx_dma_count()) : HardwareSerial::available(); }
+    int peek() override { return rx_dma ? rx_ring.peek(rx_buffer, rx_dma_count()) : HardwareSerial::peek(); }
+    int read() override { return rx_dma ? rx_ring.read(rx_buffer, rx_dma_count()) : HardwareSerial::read(); }
+
+    // Called by the line-idle interrupt
+    void rx_idle() {
+      #if ENABLED(EMERGENCY_PARSER)
+        rx_ring.scan(rx_buffer, rx_dma_count(), [this](const uint8_t c) { emergency_parser.update(emergency_state, c); });
+      #endif
+    }
+
+    #if HAS_SERIAL_DMA_TX
+      // A ring of SERIAL_DMA_TX_SIZE sent out by DMA, one contiguous run at a
+      // time, or nullptr for the framework's TX interrupt per byte
+      uint8_t * const tx_buffer;
+      dma_dev * const tx_dma;
+      const dma_channel tx_dma_channel;
+      volatile uint16_t tx_head = 0, tx_tail = 0, tx_sending = 0;
+
+      using HardwareSerial::write;
+      size_t write(uint8_t c) override;
+      void flush() override;
+      void tx_dma_service();
+
+      // Room for n bytes (or a full ring) without waiting on the DMA
+      bool tx_room(const uint16_t n) {
+        return !tx_buffer || uint16_t((tx_tail - tx_head - 1) & (SERIAL_DMA_TX_SIZE - 1)) >= _MIN(n, uint16_t(SERIAL_DMA_TX_SIZE - 1));
+      }
+    #else
+      bool tx_room(const uint16_t) { return true; }
+    #endif
+
+    void dma_begin();
+  #endif
+
+  MarlinSerial(struct usart_dev *usart_device, uint8 tx_pin, uint8 rx_pin, bool TERN_(EMERGENCY_PARSER, ep_capable), uint8_t * const rxbuf=nullptr
+    #if ENABLED(SERIAL_DMA)
+      , dma_dev * const rxdma=nullptr, const dma_channel rxch=DMA_CH1
+      #if HAS_SERIAL_DMA_TX
+        , uint8_t * const txbuf=nullptr, dma_dev * const txdma=nullptr, const dma_channel txch=DMA_CH1
+      #endif
+    #endif
+  ) :
     HardwareSerial(usart_device, tx_pin, rx_pin)
     #if ENABLED(EMERGENCY_PARSER)
       , ep_enabled(ep_capable)
       , emergency_state(EmergencyParser::State::EP_RESET)
     #endif
+    , rx_buffer(rxbuf)
+    #if ENABLED(SERIAL_DMA)
+      , rx_dma(rxbuf ? rxdma : nullptr), rx_dma_channel(rxch)
+      #if HAS_SERIAL_DMA_TX
+        , tx_buffer(txdma ? txbuf : nullptr), tx_dma(txdma), tx_dma_channel(txch)
+      #endif
+    #endif
     { }
 
-  #ifdef UART_IRQ_PRIO
-    // Shadow the parent methods to set IRQ priority after begin()
-    void begin(uint32 baud) {
-      MarlinSerial::begin(baud, SERIAL_8N1);
-    }
+  // Shadow the parent methods to set IRQ priority and the RX buffer after begin()
+  void begin(uint32 baud) {
+    MarlinSerial::begin(baud, SERIAL_8N1);
+  }
 
-    void begin(uint32 baud, uint8_t config) {
-      HardwareSerial::begin(baud, config);
-      nvic_irq_set_priority(c_dev()->irq_num, UART_IRQ_PRIO);
+  void begin(uint32 baud, uint8_t config) {
+    HardwareSerial::begin(baud, config);
+    usart_dev * const dev = c_dev();
+    #ifdef UART_IRQ_PRIO
+      nvic_irq_set_priority(dev->irq_num, UART_IRQ_PRIO);
+    #endif
+    if (rx_buffer) {
+      nvic_irq_disable(dev->irq_num);
+      #if ENABLED(SERIAL_DMA)
+        dma_begin();
+      #else
+        rb_init(dev->rb, RX_BUFFER_SIZE, rx_buffer); // begin() just set up the framework's buffer. Swap in the bigger one.
+      #endif
+      nvic_irq_enable(dev->irq_num);
     }
-  #endif
+  }
 };
 
 extern MarlinSerial MSerial1;
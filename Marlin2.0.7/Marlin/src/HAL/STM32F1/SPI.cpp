@@ -52,6 +52,23 @@
 
 struct spi_pins { uint8_t nss, sck, miso, mosi; };
 
+#if ENABLED(SERIAL_DMA)
+  constexpr bool host_uart(const int n) {
+    return (SERIAL_PORT) == n
+      #ifdef SERIAL_PORT_2
+        || (SERIAL_PORT_2) == n
+      #endif
+    ;
+  }
+  // A host UART's DMA holds this SPI's channels for good. USART1 RX/TX and
+  // SPI2 TX/RX are DMA1 channels 5 and 4, USART3 RX/TX and SPI1 TX/RX 3 and 2.
+  static inline bool spi_dma_taken(const spi_dev * const spi_d) {
+    return (host_uart(1) && spi_d == SPI2) || (host_uart(3) && spi_d == SPI1);
+  }
+#else
+  static constexpr bool spi_dma_taken(const spi_dev * const) { return false; }
+#endif
+
 static const spi_pins* dev_to_spi_pins(spi_dev *dev);
 static void configure_gpios(spi_dev *dev, bool as_master);
 static spi_baud_rate determine_baud_rate(spi_dev *dev, uint32_t freq);
@@ -415,6 +432,21 @@ uint8_t SPIClass::dmaTransferRepeat(uint16_t length) {
  * Still in progress.
  */
 uint8_t SPIClass::dmaTransfer(const void *transmitBuf, void *receiveBuf, uint16_t length) {
+  spi_dev * spi_d = _currentSetting->spi_d;
+  if (spi_dma_taken(spi_d)) {
+    // Polled transfer, one data item at a time
+    const bool wide = _currentSetting->dataSize == DATA_SIZE_16BIT;
+    spi_rx_reg(spi_d); // read any previous data
+    for (uint16_t i = 0; i < length; i++) {
+      const uint16_t out = !transmitBuf ? 0xFFFF : wide ? ((const uint16_t*)transmitBuf)[i] : ((const uint8_t*)transmitBuf)[i];
+      spi_tx_reg(spi_d, out);
+      while (!spi_is_rx_nonempty(spi_d)) { /* nada */ }
+      const uint16_t in = spi_rx_reg(spi_d);
+      if (wide) ((uint16_t*)receiveBuf)[i] = in; else ((uint8_t*)receiveBuf)[i] = in;
+    }
+    waitSpiTxEnd(spi_d);
+    return 0;
+  }
   dmaTransferSet(transmitBuf, receiveBuf);
   return dmaTransferRepeat(length);
 }
@@ -459,12 +491,24 @@ uint8_t SPIClass::dmaSendRepeat(uint16_t length) {
   return b;
 }
 
+// Polled stand-in for dmaSend when the DMA channel is taken
+void SPIClass::pollSend(const void * transmitBuf, uint16_t length, bool minc) {
+  if (length == 0) return;
+  if (minc)
+    write(transmitBuf, length);
+  else
+    write(_currentSetting->dataSize == DATA_SIZE_16BIT ? *(const uint16_t*)transmitBuf : *(const uint8_t*)transmitBuf, length);
+}
+
 uint8_t SPIClass::dmaSend(const void * transmitBuf, uint16_t length, bool minc) {
+  if (spi_dma_taken(_currentSetting->spi_d)) { pollSend(transmitBuf, length, minc); return 0; }
   dmaSendSet(transmitBuf, minc);
   return dmaSendRepeat(length);
 }
 
 uint8_t SPIClass::dmaSendAsync(const void * transmitBuf, uint16_t length, bool minc) {
+  if (spi_dma_taken(_currentSetting->spi_d)) { pollSend(transmitBuf, length, minc); return 0; }
+
   uint8_t b = 0;
 
   if (_currentSetting->state != SPI_STATE_READY) {
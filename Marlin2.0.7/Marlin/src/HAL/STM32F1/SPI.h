@@ -384,6 +384,9 @@ private:
 
   void updateSettings();
 
+  // dmaSend without DMA, for an SPI whose channels are taken (SERIAL_DMA)
+  void pollSend(const void * transmitBuf, uint16_t length, bool minc);
+
   /*
    * Functions added for DMA transfers with Callback.
    * Experimental.
@@ -48,6 +48,28 @@
   #error "SERIAL_STATS_DROPPED_RX is not supported on this platform."
 #endif
 
+#if ENABLED(SERIAL_DMA)
+  #if !(WITHIN(SERIAL_PORT, 1, 4) || (defined(SERIAL_PORT_2) && WITHIN(SERIAL_PORT_2, 1, 4)))
+    #error "SERIAL_DMA requires SERIAL_PORT or SERIAL_PORT_2 to be UART 1 to 4."
+  #elif RX_BUFFER_SIZE < 64 || RX_BUFFER_SIZE > 32768
+    #error "SERIAL_DMA requires an RX_BUFFER_SIZE from 64 to 32768."
+  #elif ENABLED(STEP_PULSE_DMA) && (SERIAL_PORT == 4 || (defined(SERIAL_PORT_2) && SERIAL_PORT_2 == 4))
+    #error "SERIAL_DMA on UART4 needs DMA2 channel 3, which STEP_PULSE_DMA uses."
+  #elif HAS_SERIAL_DMA_TX && (SERIAL_DMA_TX_SIZE < 32 || SERIAL_DMA_TX_SIZE > 4096 || !IS_POWER_OF_2(SERIAL_DMA_TX_SIZE))
+    #error "SERIAL_DMA_TX_SIZE must be 0 or a power of 2 from 32 to 4096."
+  #endif
+#endif
+
 #if ENABLED(NEOPIXEL_LED)
   #error "NEOPIXEL_LED (Adafruit NeoPixel) is not supported for HAL/STM32F1. Comment out this line to proceed at your own risk!"
 #endif
+
+#if ENABLED(STEP_PULSE_DMA)
+  #ifndef STM32_HIGH_DENSITY
+    #error "STEP_PULSE_DMA requires Timer 8 and DMA2 (STM32F103xC/D/E/F/G)."
+  #elif STEP_TIMER_NUM == STEP_DMA_TIMER_NUM || TEMP_TIMER_NUM == STEP_DMA_TIMER_NUM || SERVO0_TIMER_NUM == STEP_DMA_TIMER_NUM
+    #error "STEP_PULSE_DMA needs Timer 8, but it's already in use."
+  #elif ENABLED(ENABLE_SPI3) || (defined(ONBOARD_SPI_DEVICE) && ONBOARD_SPI_DEVICE == 3)
+    #error "SPI3 transfers need DMA2 channels 1 and 2, which STEP_PULSE_DMA uses."
+  #endif
+#endif
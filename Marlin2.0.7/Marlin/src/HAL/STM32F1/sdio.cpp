@@ -32,10 +32,97 @@
 
 SDIO_CardInfoTypeDef SdCard;
 
+#if ENABLED(SDIO_READ_AHEAD)
+
+  /**
+   * Read-ahead ring in two halves. While the file system reads from one half,
+   * the other half is filled by a multi-block read (CMD18) that DMA completes
+   * on its own. A finished transfer is picked up on the next card access, so
+   * the card is never commanded from an interrupt.
+   */
+  #define RA_HALF_BLOCKS ((SDIO_READ_AHEAD_BLOCKS) / 2)
+
+  enum ReadAheadState : uint8_t { RA_EMPTY, RA_LOADING, RA_READY };
+
+  static uint32_t ra_buffer[2][RA_HALF_BLOCKS][128];  // Word-aligned for DMA
+  static uint32_t ra_block[2];                        // First block in each half
+  static ReadAheadState ra_state[2];
+  static uint32_t ra_last_block = 0xFFFFFFFEU;        // Last block read, to detect sequential reads
+
+  // Start filling a half with the given block and the ones after it
+  static void SDIO_ReadAhead_Start(const uint8_t h, const uint32_t blockAddress) {
+    ra_state[h] = RA_EMPTY;
+    if (blockAddress + RA_HALF_BLOCKS > SdCard.LogBlockNbr) return;
+    if (SDIO_GetCardState() != SDIO_CARD_TRANSFER) return;
+
+    dma_setup_transfer(SDIO_DMA_DEV, SDIO_DMA_CHANNEL, &SDIO->FIFO, DMA_SIZE_32BITS, ra_buffer[h], DMA_SIZE_32BITS, DMA_MINC_MODE);
+    dma_set_num_transfers(SDIO_DMA_DEV, SDIO_DMA_CHANNEL, 128 * RA_HALF_BLOCKS);
+    dma_clear_isr_bits(SDIO_DMA_DEV, SDIO_DMA_CHANNEL);
+    dma_enable(SDIO_DMA_DEV, SDIO_DMA_CHANNEL);
+
+    sdio_setup_transfer(SDIO_DATA_TIMEOUT * (F_CPU / 1000U), 512U * RA_HALF_BLOCKS, SDIO_BLOCKSIZE_512 | SDIO_DCTRL_DMAEN | SDIO_DCTRL_DTEN | SDIO_DIR_RX);
+
+    if (!SDIO_CmdReadMultiBlock(SdCard.CardType == CARD_SDHC_SDXC ? blockAddress : blockAddress * 512U)) {
+      SDIO_CLEAR_FLAG(SDIO_ICR_CMD_FLAGS);
+      dma_disable(SDIO_DMA_DEV, SDIO_DMA_CHANNEL);
+      return;
+    }
+
+    ra_block[h] = blockAddress;
+    ra_state[h] = RA_LOADING;
+  }
+
+  // Complete the transfer in progress. Without 'wait' only if all its data is in.
+  static void SDIO_ReadAhead_Finish(const bool wait) {
+    LOOP_L_N(h, 2) if (ra_state[h] == RA_LOADING) {
+      if (!wait && !SDIO_GET_FLAG(SDIO_STA_DATAEND | SDIO_STA_TRX_ERROR_FLAGS)) return;
+
+      while (!SDIO_GET_FLAG(SDIO_STA_DATAEND | SDIO_STA_TRX_ERROR_FLAGS)) { /* wait */ }
+
+      // If there were SDIO errors, do not wait DMA.
+      bool ok = !(SDIO->STA & SDIO_STA_TRX_ERROR_FLAGS);
+      if (ok) {
+        while ((DMA2_BASE->ISR & (DMA_ISR_TEIF4|DMA_ISR_TCIF4)) == 0) { /* wait */ }
+        ok = !(DMA2_BASE->ISR & DMA_ISR_TEIF4);
+      }
+      dma_disable(SDIO_DMA_DEV, SDIO_DMA_CHANNEL);
+      while (SDIO->STA & SDIO_STA_RXDAVL) (void)SDIO->FIFO;
+      SDIO_CLEAR_FLAG(SDIO_ICR_CMD_FLAGS | SDIO_ICR_DATA_FLAGS);
+
+      // Stop the card sending more blocks
+      if (!SDIO_CmdStopTransfer()) ok = false;
+
+      ra_state[h] = ok ? RA_READY : RA_EMPTY;
+    }
+  }
+
+  // Copy a block from the ring, if it's there, and keep the ring ahead of the reader
+  static bool SDIO_ReadAhead_Get(const uint32_t blockAddress, uint8_t *data) {
+    LOOP_L_N(h, 2) {
+      if (ra_state[h] != RA_READY || blockAddress - ra_block[h] >= RA_HALF_BLOCKS) continue;
+      memcpy(data, ra_buffer[h][blockAddress - ra_block[h]], 512);
+
+      // Refill the other half with the blocks following this one
+      const uint8_t o = h ^ 1;
+      const uint32_t next = ra_block[h] + RA_HALF_BLOCKS;
+      if (ra_state[o] == RA_EMPTY || (ra_state[o] == RA_READY && ra_block[o] != next))
+        SDIO_ReadAhead_Start(o, next);
+      return true;
+    }
+    return false;
+  }
+
+#endif // SDIO_READ_AHEAD
+
 bool SDIO_Init() {
   uint32_t count = 0U;
   SdCard.CardType = SdCard.CardVersion = SdCard.Class = SdCard.RelCardAdd = SdCard.BlockNbr = SdCard.BlockSize = SdCard.LogBlockNbr = SdCard.LogBlockSize = 0;
 
+  #if ENABLED(SDIO_READ_AHEAD)
+    if (ra_state[0] == RA_LOADING || ra_state[1] == RA_LOADING) dma_disable(SDIO_DMA_DEV, SDIO_DMA_CHANNEL);
+    ra_state[0] = ra_state[1] = RA_EMPTY;
+  #endif
+
   sdio_begin();
   sdio_set_dbus_width(SDIO_CLKCR_WIDBUS_1BIT);
 
@@ -136,14 +223,34 @@ bool SDIO_ReadBlock_DMA(uint32_t blockAddress, uint8_t *data) {
 }
 
 bool SDIO_ReadBlock(uint32_t blockAddress, uint8_t *data) {
-  uint32_t retries = SDIO_READ_RETRIES;
-  while (retries--) if (SDIO_ReadBlock_DMA(blockAddress, data)) return true;
-  return false;
+  #if ENABLED(SDIO_READ_AHEAD)
+    SDIO_ReadAhead_Finish(false);   // Pick up a finished transfer
+    if (!SDIO_ReadAhead_Get(blockAddress, data)) {
+      SDIO_ReadAhead_Finish(true);  // The card must be idle for anything else
+      if (!SDIO_ReadAhead_Get(blockAddress, data)) {
+        uint32_t retries = SDIO_READ_RETRIES;
+        while (!SDIO_ReadBlock_DMA(blockAddress, data)) if (!--retries) return false;
+        // Reading a file? Start fetching what comes next.
+        if (blockAddress == ra_last_block + 1) SDIO_ReadAhead_Start(0, blockAddress + 1);
+      }
+    }
+    ra_last_block = blockAddress;
+    return true;
+  #else
+    uint32_t retries = SDIO_READ_RETRIES;
+    while (retries--) if (SDIO_ReadBlock_DMA(blockAddress, data)) return true;
+    return false;
+  #endif
 }
 
 uint32_t millis();
 
 bool SDIO_WriteBlock(uint32_t blockAddress, const uint8_t *data) {
+  #if ENABLED(SDIO_READ_AHEAD)
+    SDIO_ReadAhead_Finish(true);
+    LOOP_L_N(h, 2) if (blockAddress - ra_block[h] < RA_HALF_BLOCKS) ra_state[h] = RA_EMPTY;
+  #endif
+
   if (SDIO_GetCardState() != SDIO_CARD_TRANSFER) return false;
   if (blockAddress >= SdCard.LogBlockNbr) return false;
   if ((0x03 & (uint32_t)data)) return false; // misaligned data
@@ -198,8 +305,10 @@ bool SDIO_CmdSetRelAdd(uint32_t *rca) { SDIO_SendCommand(CMD3_SET_REL_ADDR, 0);
 bool SDIO_CmdSelDesel(uint32_t address) { SDIO_SendCommand(CMD7_SEL_DESEL_CARD, address); return SDIO_GetCmdResp1(SDMMC_CMD_SEL_DESEL_CARD); }
 bool SDIO_CmdOperCond() { SDIO_SendCommand(CMD8_HS_SEND_EXT_CSD, SDMMC_CHECK_PATTERN); return SDIO_GetCmdResp7(); }
 bool SDIO_CmdSendCSD(uint32_t argument) { SDIO_SendCommand(CMD9_SEND_CSD, argument); return SDIO_GetCmdResp2(); }
+bool SDIO_CmdStopTransfer() { SDIO_SendCommand(CMD12_STOP_TRANSMISSION, 0); return SDIO_GetCmdResp1(SDMMC_CMD_STOP_TRANSMISSION); }
 bool SDIO_CmdSendStatus(uint32_t argument) { SDIO_SendCommand(CMD13_SEND_STATUS, argument); return SDIO_GetCmdResp1(SDMMC_CMD_SEND_STATUS); }
 bool SDIO_CmdReadSingleBlock(uint32_t address) { SDIO_SendCommand(CMD17_READ_SINGLE_BLOCK, address); return SDIO_GetCmdResp1(SDMMC_CMD_READ_SINGLE_BLOCK); }
+bool SDIO_CmdReadMultiBlock(uint32_t address) { SDIO_SendCommand(CMD18_READ_MULT_BLOCK, address); return SDIO_GetCmdResp1(SDMMC_CMD_READ_MULT_BLOCK); }
 bool SDIO_CmdWriteSingleBlock(uint32_t address) { SDIO_SendCommand(CMD24_WRITE_SINGLE_BLOCK, address); return SDIO_GetCmdResp1(SDMMC_CMD_WRITE_SINGLE_BLOCK); }
 bool SDIO_CmdAppCommand(uint32_t rsa) { SDIO_SendCommand(CMD55_APP_CMD, rsa); return SDIO_GetCmdResp1(SDMMC_CMD_APP_CMD); }
 
@@ -36,8 +36,10 @@
 #define SDMMC_CMD_SEL_DESEL_CARD                      ((uint8_t)7)   /* Selects the card by its own relative address and gets deselected by any other address */
 #define SDMMC_CMD_HS_SEND_EXT_CSD                     ((uint8_t)8)   /* Sends SD Memory Card interface condition, which includes host supply voltage information and asks the card whether card supports voltage. */
 #define SDMMC_CMD_SEND_CSD                            ((uint8_t)9)   /* Addressed card sends its card specific data (CSD) on the CMD line. */
+#define SDMMC_CMD_STOP_TRANSMISSION                   ((uint8_t)12)  /* Forces the card to stop transmission. */
 #define SDMMC_CMD_SEND_STATUS                         ((uint8_t)13)  /*!< Addressed card sends its status register. */
 #define SDMMC_CMD_READ_SINGLE_BLOCK                   ((uint8_t)17)  /* Reads single block of size selected by SET_BLOCKLEN in case of SDSC, and a block of fixed 512 bytes in case of SDHC and SDXC. */
+#define SDMMC_CMD_READ_MULT_BLOCK                     ((uint8_t)18)  /* Continuously transfers data blocks from card to host until interrupted by STOP_TRANSMISSION command. */
 #define SDMMC_CMD_WRITE_SINGLE_BLOCK                  ((uint8_t)24)  /* Writes single block of size selected by SET_BLOCKLEN in case of SDSC, and a block of fixed 512 bytes in case of SDHC and SDXC. */
 #define SDMMC_CMD_APP_CMD                             ((uint8_t)55)  /* Indicates to the card that the next command is an application specific command rather than a standard command. */
 
@@ -51,8 +53,10 @@
 #define CMD7_SEL_DESEL_CARD                           (uint16_t)(SDMMC_CMD_SEL_DESEL_CARD | SDIO_CMD_WAIT_SHORT_RESP)
 #define CMD8_HS_SEND_EXT_CSD                          (uint16_t)(SDMMC_CMD_HS_SEND_EXT_CSD | SDIO_CMD_WAIT_SHORT_RESP)
 #define CMD9_SEND_CSD                                 (uint16_t)(SDMMC_CMD_SEND_CSD | SDIO_CMD_WAIT_LONG_RESP)
+#define CMD12_STOP_TRANSMISSION                       (uint16_t)(SDMMC_CMD_STOP_TRANSMISSION | SDIO_CMD_WAIT_SHORT_RESP)
 #define CMD13_SEND_STATUS                             (uint16_t)(SDMMC_CMD_SEND_STATUS | SDIO_CMD_WAIT_SHORT_RESP)
 #define CMD17_READ_SINGLE_BLOCK                       (uint16_t)(SDMMC_CMD_READ_SINGLE_BLOCK | SDIO_CMD_WAIT_SHORT_RESP)
+#define CMD18_READ_MULT_BLOCK                         (uint16_t)(SDMMC_CMD_READ_MULT_BLOCK | SDIO_CMD_WAIT_SHORT_RESP)
 #define CMD24_WRITE_SINGLE_BLOCK                      (uint16_t)(SDMMC_CMD_WRITE_SINGLE_BLOCK | SDIO_CMD_WAIT_SHORT_RESP)
 #define CMD55_APP_CMD                                 (uint16_t)(SDMMC_CMD_APP_CMD | SDIO_CMD_WAIT_SHORT_RESP)
 
@@ -135,8 +139,10 @@ bool SDIO_CmdSetRelAdd(uint32_t *rca);
 bool SDIO_CmdSelDesel(uint32_t address);
 bool SDIO_CmdOperCond();
 bool SDIO_CmdSendCSD(uint32_t argument);
+bool SDIO_CmdStopTransfer();
 bool SDIO_CmdSendStatus(uint32_t argument);
 bool SDIO_CmdReadSingleBlock(uint32_t address);
+bool SDIO_CmdReadMultiBlock(uint32_t address);
 bool SDIO_CmdWriteSingleBlock(uint32_t address);
 bool SDIO_CmdAppCommand(uint32_t rsa);
 
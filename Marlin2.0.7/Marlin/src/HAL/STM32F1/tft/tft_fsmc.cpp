@@ -93,6 +93,7 @@ void TFT_FSMC::Init() {
     dma_init(FSMC_DMA_DEV);
     dma_disable(FSMC_DMA_DEV, FSMC_DMA_CHANNEL);
     dma_set_priority(FSMC_DMA_DEV, FSMC_DMA_CHANNEL, DMA_PRIORITY_MEDIUM);
+    dma_attach_interrupt(FSMC_DMA_DEV, FSMC_DMA_CHANNEL, dma_service);
   #endif
 
   struct fsmc_nor_psram_reg_map* fsmcPsramRegion;
@@ -180,11 +181,13 @@ void TFT_FSMC::Init() {
 }
 
 void TFT_FSMC::Transmit(uint16_t Data) {
+  while (isBusy()) {};
   LCD->RAM = Data;
   __DSB();
 }
 
 void TFT_FSMC::WriteReg(uint16_t Reg) {
+  while (isBusy()) {};
   LCD->REG = Reg;
   __DSB();
 }
@@ -214,16 +217,64 @@ uint32_t TFT_FSMC::GetID() {
    return id;
  }
 
+#if TFT_HAS_ASYNC_DMA
+
+  static void (* volatile dma_callback)();
+  static volatile bool dma_busy;
+
+  // Finish a WriteSequence_DMA() once the count is out or the channel
+  // stopped on an error. From the DMA interrupt, or polled with it off.
+  void TFT_FSMC::dma_service() {
+    if (!dma_busy) return;
+    dma_channel_reg_map * const regs = dma_channel_regs(FSMC_DMA_DEV, FSMC_DMA_CHANNEL);
+    if (regs->CNDTR && (regs->CCR & DMA_CCR_EN)) return;
+    dma_disable(FSMC_DMA_DEV, FSMC_DMA_CHANNEL);
+    dma_clear_isr_bits(FSMC_DMA_DEV, FSMC_DMA_CHANNEL); // Before the callback, which may start the next transfer
+    dma_busy = false;
+    void (* const callback)() = dma_callback;
+    dma_callback = nullptr;
+    if (callback) callback();
+  }
+
+  void TFT_FSMC::WriteSequence_DMA(uint16_t *Data, uint16_t Count, void (*Callback)()) {
+    while (isBusy()) {};
+    dma_callback = Callback;
+    dma_busy = true;
+    dma_setup_transfer(FSMC_DMA_DEV, FSMC_DMA_CHANNEL, Data, DMA_SIZE_16BITS, &LCD->RAM, DMA_SIZE_16BITS, DMA_MEM_2_MEM | DMA_PINC_MODE | DMA_TRNS_CMPLT | DMA_TRNS_ERR);
+    dma_set_num_transfers(FSMC_DMA_DEV, FSMC_DMA_CHANNEL, Count);
+    dma_clear_isr_bits(FSMC_DMA_DEV, FSMC_DMA_CHANNEL);
+    dma_enable(FSMC_DMA_DEV, FSMC_DMA_CHANNEL);
+  }
+
+#endif
+
+// True while a WriteSequence_DMA() is sending. Polling also finishes it,
+// so waiting works with interrupts off.
 bool TFT_FSMC::isBusy() {
-  return false;
+  #if TFT_HAS_ASYNC_DMA
+    if (!dma_busy) return false;
+    CRITICAL_SECTION_START();
+    dma_service();
+    CRITICAL_SECTION_END();
+    return dma_busy;
+  #else
+    return false;
+  #endif
 }
 
 void TFT_FSMC::Abort() {
-
+  #if TFT_HAS_ASYNC_DMA
+    CRITICAL_SECTION_START();
+    dma_disable(FSMC_DMA_DEV, FSMC_DMA_CHANNEL);
+    dma_callback = nullptr;
+    dma_busy = false;
+    CRITICAL_SECTION_END();
+  #endif
 }
 
 void TFT_FSMC::TransmitDMA(uint32_t MemoryIncrease, uint16_t *Data, uint16_t Count) {
   #if defined(FSMC_DMA_DEV) && defined(FSMC_DMA_CHANNEL)
+    while (isBusy()) {};
     dma_setup_transfer(FSMC_DMA_DEV, FSMC_DMA_CHANNEL, Data, DMA_SIZE_16BITS, &LCD->RAM, DMA_SIZE_16BITS, DMA_MEM_2_MEM | MemoryIncrease);
     dma_set_num_transfers(FSMC_DMA_DEV, FSMC_DMA_CHANNEL, Count);
     dma_clear_isr_bits(FSMC_DMA_DEV, FSMC_DMA_CHANNEL);
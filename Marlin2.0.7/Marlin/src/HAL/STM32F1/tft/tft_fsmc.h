@@ -34,6 +34,10 @@
 #define DATASIZE_16BIT   DMA_SIZE_16BITS
 #define TFT_IO_DRIVER TFT_FSMC
 
+#if ENABLED(LCD_USE_DMA_FSMC)
+  #define TFT_HAS_ASYNC_DMA 1   // WriteSequence_DMA() is available
+#endif
+
 typedef struct {
   __IO uint16_t REG;
   __IO uint16_t RAM;
@@ -46,6 +50,9 @@ class TFT_FSMC {
     static uint32_t ReadID(uint16_t Reg);
     static void Transmit(uint16_t Data);
     static void TransmitDMA(uint32_t MemoryIncrease, uint16_t *Data, uint16_t Count);
+    #if TFT_HAS_ASYNC_DMA
+      static void dma_service();
+    #endif
 
   public:
     static void Init();
@@ -60,6 +67,10 @@ class TFT_FSMC {
     static void WriteReg(uint16_t Reg);
 
     static void WriteSequence(uint16_t *Data, uint16_t Count) { TransmitDMA(DMA_PINC_MODE, Data, Count); }
+    #if TFT_HAS_ASYNC_DMA
+      // Start sending and return. Callback runs from the DMA interrupt when the data is out.
+      static void WriteSequence_DMA(uint16_t *Data, uint16_t Count, void (*Callback)());
+    #endif
     static void WriteMultiple(uint16_t Color, uint16_t Count) { static uint16_t Data; Data = Color; TransmitDMA(DMA_CIRC_MODE, &Data, Count); }
     static void WriteMultiple(uint16_t Color, uint32_t Count) {
       static uint16_t Data; Data = Color;
@@ -136,6 +136,85 @@ bool HAL_timer_interrupt_enabled(const uint8_t timer_num) {
   return false;
 }
 
+#if ENABLED(STEP_PULSE_DMA)
+
+  #include <libmaple/dma.h>
+
+  #define STEP_DMA_DEV TIMER_DEV(STEP_DMA_TIMER_NUM)
+
+  uint32_t step_dma_buffer[STEP_DMA_PORTS][2 * (STEP_PULSE_DMA_EVENTS) + 1];
+
+  // Timer 8 compare channels and the DMA2 channels they request (RM0008 Table 79)
+  static const struct { uint8_t timer_chan; dma_channel dma_chan; } step_dma_req[STEP_DMA_PORTS] = {
+    { 3, DMA_CH1 }, { 1, DMA_CH3 }, { 4, DMA_CH2 }
+  };
+
+  static gpio_dev *step_dma_gpio[STEP_DMA_PORTS];
+  static uint8_t step_dma_ports; // = 0
+
+  uint8_t HAL_step_dma_port(const pin_t pin) {
+    gpio_dev * const dev = PIN_MAP[pin].gpio_device;
+    LOOP_L_N(i, step_dma_ports) if (step_dma_gpio[i] == dev) return i;
+    if (step_dma_ports == STEP_DMA_PORTS) return STEP_DMA_NO_PORT;
+    step_dma_gpio[step_dma_ports] = dev;
+    return step_dma_ports++;
+  }
+
+  static inline void step_dma_requests(const bool onoff) {
+    LOOP_L_N(i, step_dma_ports)
+      bb_peri_set_bit(&(STEP_DMA_DEV->regs).adv->DIER, TIMER_DIER_CC1DE_BIT + step_dma_req[i].timer_chan - 1, onoff);
+  }
+
+  void HAL_step_dma_init() {
+    timer_dev * const dev = STEP_DMA_DEV;
+    timer_pause(dev);
+    timer_set_prescaler(dev, (uint16_t)(STEPPER_TIMER_PRESCALE - 1)); // Same tick as the Stepper ISR
+    timer_set_reload(dev, 0xFFFF);
+    LOOP_L_N(i, STEP_DMA_PORTS) {
+      const uint8_t chan = step_dma_req[i].timer_chan;
+      timer_cc_disable(dev, chan);                                    // No output pin change
+      timer_oc_set_mode(dev, chan, TIMER_OC_MODE_FROZEN, TIMER_OC_NO_PRELOAD);
+      timer_set_compare(dev, chan, 1);                                // Request at the start of every period
+    }
+
+    dma_init(DMA2);
+    LOOP_L_N(i, step_dma_ports) {
+      const dma_channel chan = step_dma_req[i].dma_chan;
+      dma_disable(DMA2, chan);
+      dma_setup_transfer(DMA2, chan, &step_dma_gpio[i]->regs->BSRR, DMA_SIZE_32BITS, step_dma_buffer[i], DMA_SIZE_32BITS, DMA_MINC_MODE | DMA_FROM_MEM);
+      dma_set_priority(DMA2, chan, DMA_PRIORITY_VERY_HIGH);
+    }
+  }
+
+  void HAL_step_dma_start(const uint8_t events, const hal_timer_t half_period) {
+    timer_dev * const dev = STEP_DMA_DEV;
+    timer_pause(dev);
+    step_dma_requests(false);   // Drop requests left over from the last burst
+
+    LOOP_L_N(i, step_dma_ports) {
+      const dma_channel chan = step_dma_req[i].dma_chan;
+      dma_disable(DMA2, chan);
+      dma_set_mem_addr(DMA2, chan, step_dma_buffer[i]);
+      step_dma_buffer[i][events * 2] = 0; // BSRR no-op
+      dma_set_num_transfers(DMA2, chan, events * 2 + 1);
+      dma_clear_isr_bits(DMA2, chan);
+      dma_enable(DMA2, chan);
+    }
+
+    timer_set_reload(dev, half_period - 1);
+    timer_generate_update(dev); // Load ARR and clear the counter. The first words go out on the next tick.
+    step_dma_requests(true);
+    timer_resume(dev);
+  }
+
+  uint32_t HAL_step_dma_remaining() {
+    uint16_t words = 0;
+    LOOP_L_N(i, step_dma_ports) NOLESS(words, dma_get_count(DMA2, step_dma_req[i].dma_chan));
+    return words ? words * (uint32_t(timer_get_reload(STEP_DMA_DEV)) + 1) : 0;
+  }
+
+#endif // STEP_PULSE_DMA
+
 timer_dev* get_timer_dev(int number) {
   switch (number) {
     #if STM32_HAVE_TIMER(1)
@@ -196,4 +196,31 @@ FORCE_INLINE static void timer_no_ARR_preload_ARPE(timer_dev *dev) {
 
 void timer_set_interrupt_priority(uint_fast8_t timer_num, uint_fast8_t priority);
 
+#if ENABLED(STEP_PULSE_DMA)
+  /**
+   * Step pulse bursts
+   *
+   * Timer 8 paces DMA writes of precomputed words into the BSRR registers of
+   * up to three GPIO ports, so the Stepper ISR can hand off a batch of step
+   * events instead of timing every pulse itself. Each event is two words:
+   * the step pins' active levels, then their idle levels. A final no-op word
+   * holds the last idle level for a whole half-period, so a burst only counts
+   * as done once the last low pulse is long enough.
+   *
+   * The Timer 8 CC3, CC1 and CC4 requests are served by DMA2 channels 1, 3 and 2.
+   */
+  #define STEP_DMA_TIMER_NUM 8
+  #define STEP_DMA_PORTS     3
+  #define STEP_DMA_NO_PORT   0xFF
+
+  extern uint32_t step_dma_buffer[STEP_DMA_PORTS][2 * (STEP_PULSE_DMA_EVENTS) + 1];
+
+  FORCE_INLINE static uint32_t HAL_step_dma_bit(const pin_t pin) { return _BV32(PIN_MAP[pin].gpio_bit); }
+  uint8_t HAL_step_dma_port(const pin_t pin); // Claim a DMA slot for the pin's GPIO port, or STEP_DMA_NO_PORT
+  void HAL_step_dma_init();
+  void HAL_step_dma_start(const uint8_t events, const hal_timer_t half_period);
+  uint32_t HAL_step_dma_remaining(); // Ticks until the running burst is done, or 0
+  FORCE_INLINE static void HAL_step_dma_wait() { while (HAL_step_dma_remaining()) { /* nada */ } }
+#endif
+
 #define TIMER_OC_NO_PRELOAD 0 // Need to disable preload also on compare registers.
@@ -0,0 +1,82 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * Read side of a UART receive buffer filled by a circular DMA channel.
+ *
+ * The DMA owns the head: it writes byte N of the buffer when its transfer
+ * counter (CNDTR on STM32) reads SIZE - N, and reloads to SIZE after the last
+ * byte. The reader keeps its own tail, so no interrupt is needed per byte.
+ * A second tail follows the bytes already shown to the emergency parser,
+ * which catches up each time the line goes idle.
+ *
+ * If the host sends more than SIZE bytes ahead of the reader the DMA laps
+ * the tail and a buffer's worth of input is lost, as with any ring
+ * without flow control.
+ *
+ * SIZE must be a power of 2.
+ */
+template<uint16_t SIZE>
+class DmaRxRing {
+  static_assert(SIZE >= 2 && !(SIZE & (SIZE - 1)), "DmaRxRing SIZE must be a power of 2.");
+  static constexpr uint16_t mask = SIZE - 1;
+
+  volatile uint16_t tail, scan_tail;
+
+  static inline uint16_t head(const uint16_t count) { return (SIZE - count) & mask; }
+
+public:
+  DmaRxRing() { reset(); }
+
+  // Call with the DMA channel stopped or freshly loaded with SIZE
+  void reset() { tail = scan_tail = 0; }
+
+  inline uint16_t available(const uint16_t count) const { return (head(count) - tail) & mask; }
+
+  inline int peek(const volatile uint8_t * const buffer, const uint16_t count) const {
+    return head(count) == tail ? -1 : buffer[tail];
+  }
+
+  inline int read(const volatile uint8_t * const buffer, const uint16_t count) {
+    const uint16_t t = tail;
+    if (head(count) == t) return -1;
+    const uint8_t c = buffer[t];
+    tail = (t + 1) & mask;
+    return c;
+  }
+
+  // Drop everything received so far
+  inline void flush(const uint16_t count) { tail = head(count); }
+
+  // Pass each byte received since the last scan to fn. Returns the count.
+  template<typename F>
+  uint16_t scan(const volatile uint8_t * const buffer, const uint16_t count, F fn) {
+    const uint16_t h = head(count);
+    uint16_t t = scan_tail, n = 0;
+    for (; t != h; t = (t + 1) & mask, n++) fn(buffer[t]);
+    scan_tail = t;
+    return n;
+  }
+};
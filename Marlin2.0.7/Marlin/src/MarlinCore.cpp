@@ -551,7 +551,7 @@ inline void finishSDPrinting()
 inline void manage_inactivity(const bool ignore_stepper_queue = false)
 {
 
-    if(queue.length < BUFSIZE) queue.get_available_commands();
+    if(queue.has_space()) queue.get_available_commands();
 
     const millis_t ms = millis();
 
@@ -65,6 +65,27 @@ void print_bin(uint16_t val) {
   }
 }
 
+#if ENABLED(SERIAL_DMA)
+
+  // Ports without tx_room(), such as USB CDC, always count as having room
+  template<typename T>
+  static auto port_tx_room(T &port, const uint16_t n, int) -> decltype(port.tx_room(n)) { return port.tx_room(n); }
+  template<typename T>
+  static bool port_tx_room(T &, const uint16_t, long) { return true; }
+
+  bool serial_tx_room(const uint16_t n) {
+    #if !HAS_MULTI_SERIAL
+      return port_tx_room(MYSERIAL0, n, 0);
+    #elif defined(SERIAL_CATCHALL)
+      return port_tx_room(CAT(MYSERIAL,SERIAL_CATCHALL), n, 0);
+    #else
+      if ((!serial_port_index || serial_port_index == SERIAL_BOTH) && !port_tx_room(MYSERIAL0, n, 0)) return false;
+      return !serial_port_index || port_tx_room(MYSERIAL1, n, 0);
+    #endif
+  }
+
+#endif
+
 extern const char SP_X_STR[], SP_Y_STR[], SP_Z_STR[];
 
 void print_xyz(const float &x, const float &y, const float &z, PGM_P const prefix/*=nullptr*/, PGM_P const suffix/*=nullptr*/) {
@@ -317,6 +317,16 @@ void serialprint_truefalse(const bool tf);
 void serial_spaces(uint8_t count);
 
 void print_bin(const uint16_t val);
+
+// Room for n bytes of output on the current port(s) without waiting.
+// Periodic reports check it and go out on a later loop rather than stall
+// the main loop behind a full TX buffer.
+#if ENABLED(SERIAL_DMA)
+  bool serial_tx_room(const uint16_t n);
+#else
+  inline bool serial_tx_room(const uint16_t) { return true; }
+#endif
+
 void print_xyz(const float &x, const float &y, const float &z, PGM_P const prefix=nullptr, PGM_P const suffix=nullptr);
 
 inline void print_xyz(const xyz_pos_t &xyz, PGM_P const prefix=nullptr, PGM_P const suffix=nullptr) {
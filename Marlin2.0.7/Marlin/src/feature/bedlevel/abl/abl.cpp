@@ -242,12 +242,6 @@ void print_bilinear_leveling_grid() {
   }
 #endif // ABL_BILINEAR_SUBDIVISION
 
-// Refresh after other values have been updated
-void refresh_bed_level() {
-  bilinear_grid_factor = bilinear_grid_spacing.reciprocal();
-  TERN_(ABL_BILINEAR_SUBDIVISION, bed_level_virt_interpolate());
-}
-
 #if ENABLED(ABL_BILINEAR_SUBDIVISION)
   #define ABL_BG_SPACING(A) bilinear_grid_spacing_virt.A
   #define ABL_BG_FACTOR(A)  bilinear_grid_factor_virt.A
@@ -262,8 +256,79 @@ void refresh_bed_level() {
   #define ABL_BG_GRID(X,Y)  z_values[X][Y]
 #endif
 
+#if ENABLED(ABL_BILINEAR_CACHE)
+
+  /**
+   * Bilinear coefficients of each grid cell, in 1/65536 mm:
+   *   z = a + b * u + c * v + d * u * v
+   * with u, v the position within the cell, from 0 to 1.
+   */
+  typedef struct { int32_t a, b, c, d; } abl_cell_t;
+
+  #define ABL_CELL_ONE 65536L
+
+  static abl_cell_t abl_cells[ABL_BG_POINTS_X - 1][ABL_BG_POINTS_Y - 1];
+  static xy_float_t abl_cell_scale;   // Grid factor in 1/65536 cell per mm
+  static bool abl_cells_valid;        // False until a complete mesh is cached
+
+  static void bilinear_cache_refresh() {
+    abl_cells_valid = false;
+    if (!ABL_BG_SPACING(x) || !ABL_BG_SPACING(y)) return;
+
+    LOOP_L_N(x, ABL_BG_POINTS_X - 1) LOOP_L_N(y, ABL_BG_POINTS_Y - 1) {
+      const float z1 = ABL_BG_GRID(x, y),     z2 = ABL_BG_GRID(x, y + 1),     // left-front, left-back
+                  z3 = ABL_BG_GRID(x + 1, y), z4 = ABL_BG_GRID(x + 1, y + 1); // right-front, right-back
+      if (isnan(z1) || isnan(z2) || isnan(z3) || isnan(z4)) return;
+      abl_cell_t &cell = abl_cells[x][y];
+      cell.a = LROUND(z1 * ABL_CELL_ONE);
+      cell.b = LROUND((z3 - z1) * ABL_CELL_ONE);
+      cell.c = LROUND((z2 - z1) * ABL_CELL_ONE);
+      cell.d = LROUND((z4 - z3 - z2 + z1) * ABL_CELL_ONE);
+    }
+
+    abl_cell_scale.set(ABL_BG_FACTOR(x) * ABL_CELL_ONE, ABL_BG_FACTOR(y) * ABL_CELL_ONE);
+    abl_cells_valid = true;
+  }
+
+  /**
+   * Get the cell index along one axis and the position
+   * within the cell, in 1/65536 of the cell size.
+   */
+  static inline uint8_t bilinear_cell_pos(const float rel, const float scale, const uint8_t points, int32_t &frac) {
+    #if ENABLED(EXTRAPOLATE_BEYOND_GRID)
+      // Keep using the last grid box. Limit the distance to keep the fixed-point math in range.
+      const int32_t t = constrain(rel * scale, -1000.0f * ABL_CELL_ONE, 1000.0f * ABL_CELL_ONE);
+      const uint8_t cell = t < 0 ? 0 : _MIN(uint16_t(t >> 16), uint16_t(points - 2));
+    #else
+      // Beyond the grid maintain height at grid edges
+      const int32_t t = constrain(rel * scale, 0.0f, float(points - 1) * ABL_CELL_ONE);
+      const uint8_t cell = _MIN(uint16_t(t >> 16), uint16_t(points - 2));
+    #endif
+    frac = t - (int32_t(cell) << 16);
+    return cell;
+  }
+
+  // Get the Z adjustment from the cached cell coefficients
+  static float bilinear_cache_z(const xy_pos_t &raw) {
+    int32_t u, v;
+    const uint8_t cx = bilinear_cell_pos(raw.x - bilinear_start.x, abl_cell_scale.x, ABL_BG_POINTS_X, u),
+                  cy = bilinear_cell_pos(raw.y - bilinear_start.y, abl_cell_scale.y, ABL_BG_POINTS_Y, v);
+    const abl_cell_t &cell = abl_cells[cx][cy];
+    const int64_t buv = int64_t(cell.b) * u + (cell.c + ((int64_t(cell.d) * u) >> 16)) * v;
+    return (cell.a + int32_t(buv >> 16)) * (1.0f / ABL_CELL_ONE);
+  }
+
+#endif // ABL_BILINEAR_CACHE
+
+// Refresh after other values have been updated
+void refresh_bed_level() {
+  bilinear_grid_factor = bilinear_grid_spacing.reciprocal();
+  TERN_(ABL_BILINEAR_SUBDIVISION, bed_level_virt_interpolate());
+  TERN_(ABL_BILINEAR_CACHE, bilinear_cache_refresh());
+}
+
 // Get the Z adjustment for non-linear bed leveling
-float bilinear_z_offset(const xy_pos_t &raw) {
+float TERN(ABL_BILINEAR_CACHE, bilinear_z_offset_uncached, bilinear_z_offset)(const xy_pos_t &raw) {
 
   static float z1, d2, z3, d4, L, D;
 
@@ -346,10 +411,47 @@ float bilinear_z_offset(const xy_pos_t &raw) {
   return offset;
 }
 
+#if ENABLED(ABL_BILINEAR_CACHE)
+
+  float bilinear_z_offset(const xy_pos_t &raw) {
+    return abl_cells_valid ? bilinear_cache_z(raw) : bilinear_z_offset_uncached(raw);
+  }
+
+#endif
+
 #if IS_CARTESIAN && DISABLED(SEGMENT_LEVELED_MOVES)
 
   #define CELL_INDEX(A,V) ((V - bilinear_start.A) * ABL_BG_FACTOR(A))
 
+  /**
+   * Move to destination within one grid cell. Leveled Z is quadratic along
+   * a straight line, so with the cell cache split the move into only as
+   * many pieces as needed to stay within ABL_BILINEAR_MAX_ERROR.
+   */
+  static void bilinear_cell_line_to_destination(const feedRate_t &scaled_fr_mm_s, const xy_int_t &c) {
+    #if ENABLED(ABL_BILINEAR_CACHE)
+      if (abl_cells_valid) {
+        // The quadratic term of Z along the move, in mm. Its chord error over n pieces is twist / (4 * n^2).
+        const float twist = ABS(abl_cells[c.x][c.y].d * (1.0f / ABL_CELL_ONE)
+                              * (destination.x - current_position.x) * ABL_BG_FACTOR(x)
+                              * (destination.y - current_position.y) * ABL_BG_FACTOR(y));
+        uint16_t segments = CEIL(SQRT(twist * (0.25f / (ABL_BILINEAR_MAX_ERROR))));
+        if (segments > 1) {
+          const xyze_pos_t end = destination;
+          const xyze_float_t segment_distance = (end - current_position) * RECIPROCAL(segments);
+          while (--segments) {
+            current_position += segment_distance;
+            line_to_current_position(scaled_fr_mm_s);
+          }
+        }
+      }
+    #else
+      UNUSED(c);
+    #endif
+    current_position = destination;
+    line_to_current_position(scaled_fr_mm_s);
+  }
+
   /**
    * Prepare a bilinear-leveled linear move on Cartesian,
    * splitting the move where it crosses grid borders.
@@ -365,8 +467,7 @@ float bilinear_z_offset(const xy_pos_t &raw) {
 
     // Start and end in the same cell? No split needed.
     if (c1 == c2) {
-      current_position = destination;
-      line_to_current_position(scaled_fr_mm_s);
+      bilinear_cell_line_to_destination(scaled_fr_mm_s, c1);
       return;
     }
 
@@ -398,8 +499,7 @@ float bilinear_z_offset(const xy_pos_t &raw) {
     else {
       // Must already have been split on these border(s)
       // This should be a rare case.
-      current_position = destination;
-      line_to_current_position(scaled_fr_mm_s);
+      bilinear_cell_line_to_destination(scaled_fr_mm_s, c2);
       return;
     }
 
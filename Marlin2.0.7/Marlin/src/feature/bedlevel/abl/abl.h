@@ -27,6 +27,9 @@ extern xy_pos_t bilinear_grid_spacing, bilinear_start;
 extern xy_float_t bilinear_grid_factor;
 extern bed_mesh_t z_values;
 float bilinear_z_offset(const xy_pos_t &raw);
+#if ENABLED(ABL_BILINEAR_CACHE)
+  float bilinear_z_offset_uncached(const xy_pos_t &raw);
+#endif
 
 void extrapolate_unprobed_bed_level();
 void print_bilinear_leveling_grid();
@@ -141,6 +141,8 @@ void set_bed_leveling_enabled(const bool enable/*=true*/)
             // Force bilinear_z_offset to re-calculate next time
             const xyz_pos_t reset { -9999.999, -9999.999, 0 };
             (void)bilinear_z_offset(reset);
+            // The mesh may have been changed without a refresh
+            TERN_(ABL_BILINEAR_CACHE, if (enable) refresh_bed_level());
         }
 #endif
 
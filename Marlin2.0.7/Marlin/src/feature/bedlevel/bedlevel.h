@@ -75,7 +75,7 @@ typedef float bed_mesh_t[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
 #include "ubl/ubl.h"
 #endif
 
-#define Z_VALUES(X,Y) auto_manu_level_sel?ABL_Z_VALUES_ARR[X][Y]:MBL_Z_VALUES_ARR[X][Y]
+#define Z_VALUES(X,Y) (auto_manu_level_sel?ABL_Z_VALUES_ARR[X][Y]:MBL_Z_VALUES_ARR[X][Y])
 #define _GET_MESH_POS(M) auto_manu_level_sel?{ _ABL_GET_MESH_X(M.a), _ABL_GET_MESH_Y(M.b) }:{ _MBL_GET_MESH_X(M.a), _MBL_GET_MESH_Y(M.b) }
 
 #if EITHER(AUTO_BED_LEVELING_BILINEAR, MESH_BED_LEVELING)
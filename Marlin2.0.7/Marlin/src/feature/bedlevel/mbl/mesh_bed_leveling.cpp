@@ -59,6 +59,30 @@ void mesh_bed_leveling::reset()
 
 #if IS_CARTESIAN && DISABLED(SEGMENT_LEVELED_MOVES)
 
+/**
+ * Move to destination within one mesh cell. Leveled Z is quadratic along
+ * a straight line, so split the move into only as many pieces as the
+ * cell's twist needs to stay within MBL_MAX_ERROR.
+ */
+static void mbl_cell_line_to_destination(const feedRate_t &scaled_fr_mm_s, const xy_int8_t &c)
+{
+    // The quadratic term of Z along the move, in mm. Its chord error over n pieces is twist / (4 * n^2).
+    const float d = mbl.z_values[c.x + 1][c.y + 1] - mbl.z_values[c.x + 1][c.y] - mbl.z_values[c.x][c.y + 1] + mbl.z_values[c.x][c.y],
+                twist = ABS(d * (destination.x - current_position.x) * RECIPROCAL(MESH_X_DIST)
+                              * (destination.y - current_position.y) * RECIPROCAL(MESH_Y_DIST));
+    uint16_t segments = CEIL(SQRT(twist * (0.25f / (MBL_MAX_ERROR))));
+    if(segments > 1) {
+        const xyze_pos_t end = destination;
+        const xyze_float_t segment_distance = (end - current_position) * RECIPROCAL(segments);
+        while(--segments) {
+            current_position += segment_distance;
+            line_to_current_position(scaled_fr_mm_s);
+        }
+    }
+    current_position = destination;
+    line_to_current_position(scaled_fr_mm_s);
+}
+
 /**
  * Prepare a mesh-leveled linear move in a Cartesian setup,
  * splitting the move where it crosses mesh borders.
@@ -74,8 +98,7 @@ void mesh_bed_leveling::line_to_destination(const feedRate_t &scaled_fr_mm_s, ui
 
     // Start and end in the same cell? No split needed.
     if(scel == ecel) {
-        line_to_destination(scaled_fr_mm_s);
-        current_position = destination;
+        mbl_cell_line_to_destination(scaled_fr_mm_s, scel);
         return;
     }
 
@@ -106,8 +129,7 @@ void mesh_bed_leveling::line_to_destination(const feedRate_t &scaled_fr_mm_s, ui
     } else {
         // Must already have been split on these border(s)
         // This should be a rare case.
-        line_to_destination(scaled_fr_mm_s);
-        current_position = destination;
+        mbl_cell_line_to_destination(scaled_fr_mm_s, ecel);
         return;
     }
 
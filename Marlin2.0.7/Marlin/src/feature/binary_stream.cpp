@@ -31,6 +31,11 @@ char* SDFileTransferProtocol::Packet::Open::data = nullptr;
 size_t SDFileTransferProtocol::data_waiting, SDFileTransferProtocol::transfer_timeout, SDFileTransferProtocol::idle_timeout;
 bool SDFileTransferProtocol::transfer_active, SDFileTransferProtocol::dummy_transfer, SDFileTransferProtocol::compression;
 
+#if ENABLED(BINARY_GCODE_STREAM)
+  const char* GCodeStreamProtocol::data = nullptr;
+  uint16_t GCodeStreamProtocol::length, GCodeStreamProtocol::index;
+#endif
+
 BinaryStream binaryStream[NUM_SERIAL];
 
 #endif
@@ -212,9 +212,49 @@ public:
   static const uint16_t VERSION_MAJOR = 0, VERSION_MINOR = 1, VERSION_PATCH = 0, TIMEOUT = 10000, IDLE_PERIOD = 1000;
 };
 
+#if ENABLED(BINARY_GCODE_STREAM)
+
+/**
+ * G-code streamed straight into the command queue. A WRITE packet holds
+ * whole lines. GCodeQueue takes them from the packet buffer as the queue
+ * has room, and no new packet is read until they're all queued. The
+ * packet's "ok<sync>" stands in for the "ok" after each line.
+ */
+class GCodeStreamProtocol {
+private:
+  enum class GCodeStream : uint8_t { QUERY, WRITE };
+
+public:
+  static const char *data;    // Lines from the last WRITE packet
+  static uint16_t length,     // Bytes in the packet
+                  index;      // Bytes already queued
+
+  static bool busy() { return index < length; }
+
+  static void process(uint8_t packet_type, char* buffer, const uint16_t size) {
+    switch (static_cast<GCodeStream>(packet_type)) {
+      case GCodeStream::QUERY:
+        SERIAL_ECHOLNPAIR("PGS:version:", VERSION_MAJOR, ".", VERSION_MINOR, ".", VERSION_PATCH, ":window:", BINARY_STREAM_WINDOW);
+        break;
+      case GCodeStream::WRITE:
+        data = buffer;
+        length = size;
+        index = 0;
+        break;
+      default:
+        SERIAL_ECHOLNPGM("PGS:invalid");
+        break;
+    }
+  }
+
+  static const uint16_t VERSION_MAJOR = 0, VERSION_MINOR = 1, VERSION_PATCH = 0;
+};
+
+#endif
+
 class BinaryStream {
 public:
-  enum class Protocol : uint8_t { CONTROL, FILE_TRANSFER };
+  enum class Protocol : uint8_t { CONTROL, FILE_TRANSFER, GCODE_STREAM };
 
   enum class ProtocolControl : uint8_t { SYNC = 1, CLOSE };
 
@@ -309,6 +349,9 @@ public:
           * Data stream packet handling
           */
         case StreamState::PACKET_RESET:
+          #if ENABLED(BINARY_GCODE_STREAM)
+            if (GCodeStreamProtocol::busy()) return;  // The last packet isn't all queued yet
+          #endif
           packet.reset();
           stream_state = StreamState::PACKET_WAIT;
         case StreamState::PACKET_WAIT:
@@ -454,6 +497,11 @@ public:
       case Protocol::FILE_TRANSFER:
         SDFileTransferProtocol::process(packet.header.type(), packet.buffer, packet.header.size); // send user data to be processed
       break;
+      #if ENABLED(BINARY_GCODE_STREAM)
+        case Protocol::GCODE_STREAM:
+          GCodeStreamProtocol::process(packet.header.type(), packet.buffer, packet.header.size);
+          break;
+      #endif
       default:
         SERIAL_ECHO_MSG("Unsupported Binary Protocol");
     }
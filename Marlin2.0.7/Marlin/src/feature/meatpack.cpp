@@ -0,0 +1,121 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(MEATPACK)
+
+#include "meatpack.h"
+
+MeatPack meatpack[NUM_SERIAL];
+
+#define MEATPACK_PROTOCOL_VERSION "PV01"
+
+// The 15 most common characters in G-code. 0b1111 marks a full-width character.
+static const char meatpack_table[15] PROGMEM = {
+  '0', '1', '2', '3', '4', '5', '6', '7', '8', '9',
+  '.', ' ', '\n', 'G', 'X'
+};
+
+#define SPACE_CODE 11
+
+void MeatPack::reset() {
+  active = no_spaces = false;
+  cmd_count = literals = 0;
+  held = '\0';
+}
+
+char MeatPack::unpack(const uint8_t code) const {
+  return (code == SPACE_CODE && no_spaces) ? 'E' : pgm_read_byte(&meatpack_table[code]);
+}
+
+/**
+ * Decode a byte that isn't part of a command
+ */
+void MeatPack::decode_byte(const uint8_t c, char (&out)[kMaxChars], uint8_t &n) {
+  if (!active)                              // Packing is off. Pass it through.
+    out[n++] = c;
+  else if (literals) {                      // A full-width character
+    out[n++] = c;
+    if (held) { out[n++] = held; held = '\0'; }
+    literals--;
+  }
+  else {
+    const uint8_t lo = c & 0x0F, hi = c >> 4;
+    if (lo == 0x0F) {                       // The 1st character follows in full...
+      literals = 1;
+      if (hi == 0x0F) literals++;           // ...and so does the 2nd
+      else held = unpack(hi);               // ...ahead of the packed 2nd
+    }
+    else {
+      const char c1 = unpack(lo);
+      out[n++] = c1;
+      if (c1 != '\n') {                     // A newline ends the byte
+        if (hi == 0x0F) literals++;
+        else out[n++] = unpack(hi);
+      }
+    }
+  }
+}
+
+uint8_t MeatPack::decode(const uint8_t c, char (&out)[kMaxChars], const int8_t port) {
+  uint8_t n = 0;
+
+  if (cmd_count == 2) {                     // 0xFF 0xFF came before
+    cmd_count = 0;
+    handle_command(c, port);
+  }
+  else if (c == kCommandByte) {             // Maybe the start of a command
+    cmd_count++;
+  }
+  else {
+    if (cmd_count) {                        // A lone 0xFF is two full-width flags
+      cmd_count = 0;
+      decode_byte(kCommandByte, out, n);
+    }
+    decode_byte(c, out, n);
+  }
+
+  return n;
+}
+
+void MeatPack::handle_command(const uint8_t cmd, const int8_t port) {
+  switch (cmd) {
+    case CMD_ENABLE_PACKING:    active = true;       break;
+    case CMD_DISABLE_PACKING:   active = false;      break;
+    case CMD_RESET_ALL:         reset();             break;
+    case CMD_ENABLE_NO_SPACES:  no_spaces = true;    break;
+    case CMD_DISABLE_NO_SPACES: no_spaces = false;   break;
+    case CMD_QUERY_CONFIG:
+    default: break;
+  }
+  report_state(port);
+}
+
+void MeatPack::report_state(const int8_t port) const {
+  PORT_REDIRECT(port);
+  SERIAL_ECHOPGM("[MP] " MEATPACK_PROTOCOL_VERSION " ");
+  serialprint_onoff(active);
+  serialprintPGM(no_spaces ? PSTR(" NSP\n") : PSTR(" ESP\n"));
+}
+
+#endif // MEATPACK
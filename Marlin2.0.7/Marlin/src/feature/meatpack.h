@@ -0,0 +1,74 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * meatpack.h - Packed G-code serial transport (MeatPack protocol)
+ *
+ * The 15 most common G-code characters are sent as 4-bit codes, two to a
+ * byte. The code 0b1111 means that character comes as a full byte instead,
+ * after the packed byte. With "no spaces" the space code stands for 'E' and
+ * the host drops the spaces, which the parser doesn't need.
+ *
+ * The host switches packing with 0xFF 0xFF <command>. Marlin answers each
+ * command with "[MP] PV01 ON|OFF NSP|ESP".
+ */
+
+#include "../inc/MarlinConfigPre.h"
+
+class MeatPack {
+public:
+  static constexpr uint8_t kCommandByte = 0xFF,
+                           kMaxChars = 4;     // Most characters from one byte (after a lone 0xFF)
+
+  enum Command : uint8_t {
+    CMD_DISABLE_NO_SPACES = 0xF6,
+    CMD_ENABLE_NO_SPACES  = 0xF7,
+    CMD_QUERY_CONFIG      = 0xF8,
+    CMD_RESET_ALL         = 0xF9,
+    CMD_DISABLE_PACKING   = 0xFA,
+    CMD_ENABLE_PACKING    = 0xFB
+  };
+
+  MeatPack() { reset(); }
+
+  void reset();
+
+  /**
+   * Decode one byte from the serial port. Put the characters it
+   * completes into 'out' and return the count. Commands are handled here.
+   */
+  uint8_t decode(const uint8_t c, char (&out)[kMaxChars], const int8_t port);
+
+private:
+  bool active, no_spaces;
+  uint8_t cmd_count,  // Command bytes in a row (0xFF 0xFF)
+          literals;   // Full-width characters still to come
+  char held;          // A packed 2nd character waiting behind a literal 1st
+
+  char unpack(const uint8_t code) const;
+  void decode_byte(const uint8_t c, char (&out)[kMaxChars], uint8_t &n);
+  void handle_command(const uint8_t cmd, const int8_t port);
+  void report_state(const int8_t port) const;
+};
+
+extern MeatPack meatpack[NUM_SERIAL];
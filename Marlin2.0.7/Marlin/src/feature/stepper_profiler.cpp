@@ -0,0 +1,105 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * stepper_profiler.cpp - Cycle accounting for the Stepper ISR
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(STEPPER_ISR_PROFILING)
+
+#include "stepper_profiler.h"
+
+StepperProfiler stepper_profiler;
+
+isr_phase_stats_t StepperProfiler::phase[ISR_PHASE_COUNT];
+uint32_t StepperProfiler::loops_exhausted,
+         StepperProfiler::histogram[STEPPER_ISR_HISTOGRAM_BUCKETS];
+millis_t StepperProfiler::start_ms;
+
+void StepperProfiler::init() {
+  #ifndef __PLAT_LINUX__
+    CM_DEMCR |= _BV(24);          // TRCENA: Enable the DWT unit
+    #if defined(__CORTEX_M) && __CORTEX_M == 7
+      CM_DWT_LAR = 0xC5ACCE55;    // Unlock DWT on the M7
+    #endif
+    CM_DWT_CYCCNT = 0;
+    CM_DWT_CTRL |= _BV(0);        // CYCCNTENA
+  #endif
+  reset();
+}
+
+void StepperProfiler::reset() {
+  const bool was_enabled = STEPPER_ISR_ENABLED();
+  if (was_enabled) DISABLE_STEPPER_DRIVER_INTERRUPT();
+  ZERO(phase);
+  ZERO(histogram);
+  loops_exhausted = 0;
+  start_ms = millis();
+  if (was_enabled) ENABLE_STEPPER_DRIVER_INTERRUPT();
+}
+
+void StepperProfiler::report_phase(PGM_P const name, const isr_phase_stats_t &s) {
+  if (!s.calls) return;
+  serialprintPGM(name);
+  SERIAL_ECHOLNPAIR(": calls ", s.calls, " avg ", uint32_t(s.total / s.calls), " max ", s.max);
+}
+
+void StepperProfiler::report() {
+  // Take a consistent snapshot, then print with the ISR running
+  const bool was_enabled = STEPPER_ISR_ENABLED();
+  if (was_enabled) DISABLE_STEPPER_DRIVER_INTERRUPT();
+  isr_phase_stats_t p[ISR_PHASE_COUNT];
+  uint32_t h[STEPPER_ISR_HISTOGRAM_BUCKETS];
+  COPY(p, phase);
+  COPY(h, histogram);
+  const uint32_t exhausted = loops_exhausted;
+  const millis_t elapsed = millis() - start_ms;
+  if (was_enabled) ENABLE_STEPPER_DRIVER_INTERRUPT();
+
+  SERIAL_ECHOLNPAIR("Stepper ISR cycles @ ", CYCLES_PER_MICROSECOND, "MHz over ", elapsed, "ms");
+  report_phase(PSTR("pulse"), p[ISR_PHASE_PULSE]);
+  report_phase(PSTR("advance"), p[ISR_PHASE_ADVANCE]);
+  report_phase(PSTR("block"), p[ISR_PHASE_BLOCK]);
+  report_phase(PSTR("isr"), p[ISR_PHASE_TOTAL]);
+
+  // Share of the CPU consumed by the Stepper ISR
+  if (elapsed) {
+    const uint64_t budget = uint64_t(elapsed) * 1000UL * (CYCLES_PER_MICROSECOND);
+    SERIAL_ECHOLNPAIR("load ", uint32_t(p[ISR_PHASE_TOTAL].total * 1000 / budget), " permille");
+  }
+
+  SERIAL_ECHOLNPAIR("max_loops exhausted ", exhausted);
+
+  SERIAL_ECHOPGM("histogram(us)");
+  LOOP_L_N(i, STEPPER_ISR_HISTOGRAM_BUCKETS) {
+    if (!h[i]) continue;
+    SERIAL_ECHOPAIR(" ", i * (STEPPER_ISR_HISTOGRAM_US));
+    if (i < STEPPER_ISR_HISTOGRAM_BUCKETS - 1) SERIAL_ECHOPAIR("-", (i + 1) * (STEPPER_ISR_HISTOGRAM_US));
+    else SERIAL_CHAR('+');
+    SERIAL_ECHOPAIR(":", h[i]);
+  }
+  SERIAL_EOL();
+}
+
+#endif // STEPPER_ISR_PROFILING
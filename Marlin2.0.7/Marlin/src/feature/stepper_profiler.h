@@ -0,0 +1,101 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * stepper_profiler.h - Cycle accounting for the Stepper ISR
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#ifdef __PLAT_LINUX__
+  #include "../HAL/LINUX/hardware/Clock.h"
+#else
+  // Cortex-M3/M4/M7 Debug Watchpoint and Trace unit
+  #define CM_DEMCR      (*(volatile uint32_t*)0xE000EDFC)
+  #define CM_DWT_CTRL   (*(volatile uint32_t*)0xE0001000)
+  #define CM_DWT_CYCCNT (*(volatile uint32_t*)0xE0001004)
+  #define CM_DWT_LAR    (*(volatile uint32_t*)0xE0001FB0)
+#endif
+
+enum StepperISRPhase : uint8_t {
+  ISR_PHASE_PULSE,
+  ISR_PHASE_ADVANCE,
+  ISR_PHASE_BLOCK,
+  ISR_PHASE_TOTAL,
+  ISR_PHASE_COUNT
+};
+
+#define STEPPER_ISR_HISTOGRAM_BUCKETS 16
+
+typedef struct {
+  uint32_t calls, max;
+  uint64_t total;
+} isr_phase_stats_t;
+
+class StepperProfiler {
+public:
+  static isr_phase_stats_t phase[ISR_PHASE_COUNT];
+  static uint32_t loops_exhausted,                          // Times max_loops ran out and next_isr_ticks was clamped
+                  histogram[STEPPER_ISR_HISTOGRAM_BUCKETS]; // ISR durations, STEPPER_ISR_HISTOGRAM_US per bucket
+  static millis_t start_ms;
+
+  static void init();
+  static void reset();
+  static void report();
+
+  // Free-running CPU cycle counter
+  FORCE_INLINE static uint32_t cycles() {
+    #ifdef __PLAT_LINUX__
+      return uint32_t(Clock::nanos() * CYCLES_PER_MICROSECOND / 1000);
+    #else
+      return CM_DWT_CYCCNT;
+    #endif
+  }
+
+  FORCE_INLINE static void record(const StepperISRPhase p, const uint32_t start) {
+    _record(phase[p], cycles() - start);
+  }
+
+  // The whole ISR also goes into the duration histogram
+  FORCE_INLINE static void record_isr(const uint32_t start) {
+    const uint32_t c = cycles() - start;
+    _record(phase[ISR_PHASE_TOTAL], c);
+    uint32_t b = c / ((STEPPER_ISR_HISTOGRAM_US) * (CYCLES_PER_MICROSECOND));
+    NOMORE(b, uint32_t(STEPPER_ISR_HISTOGRAM_BUCKETS - 1));
+    histogram[b]++;
+  }
+
+private:
+  FORCE_INLINE static void _record(isr_phase_stats_t &s, const uint32_t c) {
+    s.calls++;
+    s.total += c;
+    if (c > s.max) s.max = c;
+  }
+
+  static void report_phase(PGM_P const name, const isr_phase_stats_t &s);
+};
+
+extern StepperProfiler stepper_profiler;
+
+// Time one ISR phase: ISR_PROFILE(ISR_PHASE_PULSE, pulse_phase_isr());
+#define ISR_PROFILE(P, V...) do{ const uint32_t _ps = StepperProfiler::cycles(); V; StepperProfiler::record(P, _ps); }while(0)
@@ -70,7 +70,7 @@ void ABL_M421(){
 					TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(x, y, z_values[x][y]));
 				}
 			}
-			TERN_(ABL_BILINEAR_SUBDIVISION, bed_level_virt_interpolate());
+			refresh_bed_level();
 		}
 		else
 			SERIAL_ERROR_MSG(STR_ERR_MESH_XY);
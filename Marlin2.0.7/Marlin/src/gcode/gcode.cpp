@@ -242,7 +242,7 @@ void GcodeSuite::dwell(millis_t time) {
 /**
  * Process the parsed command and dispatch it to its handler
  */
-void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
+void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/, const uint8_t freeing/*=1*/) {
   KEEPALIVE_STATE(IN_HANDLER);
 
  /**
@@ -897,6 +897,10 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
         case 422: M422(); break;                                  // M422: Set Z Stepper automatic alignment position using probe
       #endif
 
+      #if ENABLED(STEPPER_ISR_PROFILING)
+        case 990: M990(); break;                                  // M990: Report Stepper ISR cycle statistics
+      #endif
+
       #if ALL(HAS_SPI_FLASH, SDSUPPORT, MARLIN_DEV_MODE)
         case 993: M993(); break;                                  // M993: Backup SPI Flash to SD
         case 994: M994(); break;                                  // M994: Load a Backup from SD to SPI Flash
@@ -942,7 +946,7 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
       parser.unknown_command_warning();
   }
 
-  if (!no_ok) queue.ok_to_send();
+  if (!no_ok) queue.ok_to_send(freeing);
 }
 
 /**
@@ -950,7 +954,7 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
  * This is called from the main loop()
  */
 void GcodeSuite::process_next_command() {
-  char * const current_command = queue.command_buffer[queue.index_r];
+  char * const current_command = queue.command(queue.index_r);
 
   PORT_REDIRECT(queue.port[queue.index_r]);
 
@@ -963,7 +967,7 @@ void GcodeSuite::process_next_command() {
     SERIAL_ECHOLN(current_command);
     #if ENABLED(M100_FREE_MEMORY_DUMPER)
       SERIAL_ECHOPAIR("slot:", queue.index_r);
-      M100_dump_routine(PSTR("   Command Queue:"), &queue.command_buffer[0][0], &queue.command_buffer[BUFSIZE - 1][MAX_CMD_SIZE - 1]);
+      M100_dump_routine(PSTR("   Command Queue:"), (const char*)queue.command_buffer, (const char*)queue.command_buffer + sizeof(queue.command_buffer) - 1);
     #endif
   }
 
@@ -978,6 +982,7 @@ void GcodeSuite::process_next_command() {
  */
 
 void GcodeSuite::process_subcommands_now_P(PGM_P pgcode) {
+  TERN_(ARC_STREAMING, arc_stream_finish());          // Finish any pending arc first
   char * const saved_cmd = parser.command_ptr;        // Save the parser state
   for (;;) {
     PGM_P const delim = strchr_P(pgcode, '\n');       // Get address of next newline
@@ -987,6 +992,7 @@ void GcodeSuite::process_subcommands_now_P(PGM_P pgcode) {
     cmd[len] = '\0';                                  // End with a nul
     parser.parse(cmd);                                // Parse the command
     process_parsed_command(true);                     // Process it
+    TERN_(ARC_STREAMING, arc_stream_finish());        // A G2/G3 subcommand completes before the next one
     if (!delim) break;                                // Last command?
     pgcode = delim + 1;                               // Get the next command
   }
@@ -994,6 +1000,7 @@ void GcodeSuite::process_subcommands_now_P(PGM_P pgcode) {
 }
 
 void GcodeSuite::process_subcommands_now(char * gcode) {
+  TERN_(ARC_STREAMING, arc_stream_finish());          // Finish any pending arc first
   char * const saved_cmd = parser.command_ptr;        // Save the parser state
   for (;;) {
     char * const delim = strchr(gcode, '\n');         // Get address of next newline
@@ -1001,6 +1008,7 @@ void GcodeSuite::process_subcommands_now(char * gcode) {
     parser.parse(gcode);                              // Parse the current command
     if (delim) *delim = '\n';                         // Put back the newline
     process_parsed_command(true);                     // Process it
+    TERN_(ARC_STREAMING, arc_stream_finish());        // A G2/G3 subcommand completes before the next one
     if (!delim) break;                                // Last command?
     gcode = delim + 1;                                // Get the next command
   }
@@ -1017,7 +1025,7 @@ void GcodeSuite::process_subcommands_now(char * gcode) {
     const millis_t ms = millis();
     static millis_t next_busy_signal_ms = 0;
     if (!autoreport_paused && host_keepalive_interval && busy_state != NOT_BUSY) {
-      if (PENDING(ms, next_busy_signal_ms)) return;
+      if (PENDING(ms, next_busy_signal_ms) || !serial_tx_room(32)) return;
       switch (busy_state) {
         case IN_HANDLER:
         case IN_PROCESS:
@@ -280,6 +280,7 @@
  * ************ Custom codes - This can change to suit future G-code regulations
  * G425 - Calibrate using a conductive object. (Requires CALIBRATION_GCODE)
  * M928 - Start SD logging: "M928 filename.gco". Stop with M29. (Requires SDSUPPORT)
+ * M990 - Report Stepper ISR cycle statistics. "M990 R" to reset. (Requires STEPPER_ISR_PROFILING)
  * M993 - Backup SPI Flash to SD
  * M994 - Load a Backup from SD to SPI Flash
  * M995 - Touch screen calibration for TFT display
@@ -358,13 +359,19 @@ public:
   static int8_t get_target_e_stepper_from_command();
   static void get_destination_from_command();
 
-  static void process_parsed_command(const bool no_ok=false);
+  static void process_parsed_command(const bool no_ok=false, const uint8_t freeing=1);
   static void process_next_command();
 
   // Execute G-code in-place, preserving current G-code parameters
   static void process_subcommands_now_P(PGM_P pgcode);
   static void process_subcommands_now(char * gcode);
 
+  #if ENABLED(ARC_STREAMING)
+    // Feed the pending G2/G3 arc to the planner from the main loop
+    static bool arc_stream();
+    static void arc_stream_finish();
+  #endif
+
   static inline void home_all_axes() {
     extern const char G28_STR[];
     process_subcommands_now_P(G28_STR);
@@ -863,6 +870,8 @@ private:
 
   TERN_(MAGNETIC_PARKING_EXTRUDER, static void M951());
 
+  TERN_(STEPPER_ISR_PROFILING, static void M990());
+
   TERN_(TOUCH_SCREEN_CALIBRATION, static void M995());
 
   #if BOTH(HAS_SPI_FLASH, SDSUPPORT)
@@ -26,10 +26,16 @@
   #include "gcode.h"
   #include "../module/settings.h"
   #include "../module/temperature.h"
+  #include "../module/planner.h"
+  #include "../module/stepper.h"
   #include "../libs/hex_print.h"
   #include "../HAL/shared/eeprom_if.h"
   #include "../HAL/shared/Delay.h"
 
+  #if ENABLED(ABL_BILINEAR_CACHE)
+    #include "../feature/bedlevel/bedlevel.h"
+  #endif
+
   /**
    * Dn: G-code for development and testing
    *
@@ -184,7 +190,233 @@
         DELAY_US(10000000);
         ENABLE_ISRS();
         SERIAL_ECHOLN("FAILURE: Watchdog did not trigger board reset.");
-      }
+      } break;
+
+      case 110: { // D110 Compare the float and integer trapezoid generators
+        // Use the blocks in the planner buffer, or a pseudo-random sequence if it's empty.
+        // I<loops> sets the number of passes over the blocks.
+        struct { uint32_t initial_rate, final_rate, nominal_rate, accel, steps; } rec[BLOCK_BUFFER_SIZE];
+        uint8_t count = 0;
+        for (uint8_t b = planner.block_buffer_tail; b != planner.block_buffer_head; b = BLOCK_MOD(b + 1)) {
+          const block_t &block = planner.block_buffer[b];
+          if (block.step_event_count && !TEST(block.flag, BLOCK_BIT_SYNC_POSITION))
+            rec[count++] = { block.initial_rate, block.final_rate, block.nominal_rate, block.acceleration_steps_per_s2, block.step_event_count };
+        }
+        const bool recorded = count > 0;
+        if (!recorded) {
+          uint32_t seed = 0x2545F491;
+          auto rnd = [&](const uint32_t lo, const uint32_t hi) {
+            seed = seed * 1664525UL + 1013904223UL;
+            return lo + (seed >> 8) % (hi - lo + 1);
+          };
+          for (; count < BLOCK_BUFFER_SIZE; ++count) {
+            const uint32_t nominal = rnd(120, 40000);
+            rec[count] = { rnd(120, nominal), rnd(120, nominal), nominal, rnd(500, 200000), rnd(1, 4000) };
+          }
+        }
+
+        const uint16_t loops = _MAX(parser.ushortval('I', 100), uint16_t(1));
+        uint32_t acc, plat, acc2, plat2;
+
+        uint32_t t = micros();
+        for (uint16_t l = 0; l < loops; l++) LOOP_L_N(i, count)
+          Planner::trapezoid_steps_float(acc, plat, rec[i].initial_rate, rec[i].final_rate, rec[i].nominal_rate, rec[i].accel, rec[i].steps);
+        const uint32_t float_us = micros() - t;
+
+        t = micros();
+        for (uint16_t l = 0; l < loops; l++) LOOP_L_N(i, count)
+          Planner::trapezoid_steps_fixed(acc, plat, rec[i].initial_rate, rec[i].final_rate, rec[i].nominal_rate, rec[i].accel, rec[i].steps);
+        const uint32_t fixed_us = micros() - t;
+
+        uint8_t mismatches = 0;
+        uint32_t max_diff = 0;
+        LOOP_L_N(i, count) {
+          Planner::trapezoid_steps_float(acc, plat, rec[i].initial_rate, rec[i].final_rate, rec[i].nominal_rate, rec[i].accel, rec[i].steps);
+          Planner::trapezoid_steps_fixed(acc2, plat2, rec[i].initial_rate, rec[i].final_rate, rec[i].nominal_rate, rec[i].accel, rec[i].steps);
+          const uint32_t diff = _MAX(ABS(int32_t(acc - acc2)), ABS(int32_t(plat - plat2)));
+          if (diff) { mismatches++; NOLESS(max_diff, diff); }
+        }
+
+        const float calls = float(loops) * count;
+        SERIAL_ECHOPAIR("Blocks: ", count, " Loops: ", loops);
+        serialprintPGM(recorded ? PSTR(" (planner)") : PSTR(" (synthetic)"));
+        SERIAL_EOL();
+        SERIAL_ECHOLNPAIR("Float: ", float_us / calls, "us/block  Fixed: ", fixed_us / calls, "us/block");
+        SERIAL_ECHOLNPAIR("Mismatches: ", mismatches, " Max diff: ", max_diff, " steps");
+      } break;
+
+      #if ENABLED(S_CURVE_ACCELERATION)
+
+        case 111: { // D111 Check the fixed-point S-curve speed profile against the float Bézier curve
+          // S<curves> sets the number of random curves, each checked at 64 points
+          planner.synchronize(); // The curve coefficients are shared with the Stepper ISR
+
+          uint32_t seed = 0x2545F491;
+          auto rnd = [&](const uint32_t lo, const uint32_t hi) {
+            seed = seed * 1664525UL + 1013904223UL;
+            return lo + (seed >> 8) % (hi - lo + 1);
+          };
+
+          const uint16_t curves = _MAX(parser.ushortval('S', 100), uint16_t(1));
+          float max_err = 0, max_err_pct = 0;
+          uint32_t eval_us = 0;
+          for (uint16_t c = 0; c < curves; c++) {
+            const int32_t v0 = rnd(120, 40000), v1 = rnd(120, 40000);
+            const uint32_t ticks = rnd((STEPPER_TIMER_RATE) / 1000, (STEPPER_TIMER_RATE) / 2);
+            #ifdef __AVR__
+              const uint32_t av = 0x1000000UL / ticks;  // As get_period_inverse()
+              constexpr float av_scale = 5.9604645e-8f; // 2^-24
+            #else
+              const uint32_t av = 0xFFFFFFFFUL / ticks;
+              constexpr float av_scale = 2.3283064e-10f; // 2^-32
+            #endif
+            int32_t v[64];
+            const uint32_t t0 = micros();
+            LOOP_L_N(k, 64) v[k] = Stepper::eval_bezier_curve(v0, v1, av, ticks * k / 64);
+            eval_us += micros() - t0;
+            LOOP_L_N(k, 64) {
+              // Use the same (quantized) curve time as the ISR, to check only the evaluation
+              const float t = float(av * (ticks * k / 64)) * av_scale,
+                          ref = v0 + (v1 - v0) * t * t * t * (10 - t * (15 - 6 * t)),
+                          err = ABS(v[k] - ref);
+              NOLESS(max_err, err);
+              NOLESS(max_err_pct, err * 100 / _MAX(v0, v1));
+            }
+          }
+          SERIAL_ECHOLNPAIR("Curves: ", curves, " Points: ", curves * 64UL);
+          SERIAL_ECHOLNPAIR("Max error: ", max_err, " steps/s (", max_err_pct, "%)");
+          SERIAL_ECHOLNPAIR("Eval: ", eval_us / (curves * 64.0f), "us/point");
+          serialprintPGM(max_err <= 2 ? PSTR("PASS") : PSTR("FAIL"));
+          SERIAL_EOL();
+        } break;
+
+      #endif
+
+      #if ENABLED(ABL_BILINEAR_CACHE)
+
+        case 112: { // D112 Check the cached bilinear leveling against the float interpolation
+          // S<points> sets the number of random points, over the mesh and one cell beyond.
+          // Needs a complete mesh, e.g., from G29 or M420 S2.
+          bool complete = autoleveling_is_valid();
+          GRID_LOOP(x, y) if (isnan(z_values[x][y])) complete = false;
+          if (!complete) { SERIAL_ECHOLNPGM("No mesh"); break; }
+          refresh_bed_level();
+
+          uint32_t seed = 0x2545F491;
+          auto rnd = [&](const float lo, const float hi) {
+            seed = seed * 1664525UL + 1013904223UL;
+            return lo + (hi - lo) * ((seed >> 8) * (1.0f / 0x1000000UL));
+          };
+
+          const uint16_t points = _MAX(parser.ushortval('S', 1000), uint16_t(1));
+          const xy_pos_t lo = bilinear_start - bilinear_grid_spacing,
+                         hi = { bilinear_start.x + bilinear_grid_spacing.x * (GRID_MAX_POINTS_X),
+                                bilinear_start.y + bilinear_grid_spacing.y * (GRID_MAX_POINTS_Y) };
+          float max_err = 0, sum = 0;
+          uint32_t cached_us = 0, float_us = 0;
+          for (uint16_t i = 0; i < points; i++) {
+            const xy_pos_t pos = { rnd(lo.x, hi.x), rnd(lo.y, hi.y) };
+            uint32_t t = micros();
+            const float zc = bilinear_z_offset(pos);
+            cached_us += micros() - t;
+            t = micros();
+            const float zf = bilinear_z_offset_uncached(pos);
+            float_us += micros() - t;
+            sum += zc + zf; // Keep both calls
+            NOLESS(max_err, ABS(zc - zf));
+          }
+          SERIAL_ECHOLNPAIR("Points: ", points, " Checksum: ", sum);
+          SERIAL_ECHOLNPAIR("Max error: ", max_err, "mm");
+          SERIAL_ECHOLNPAIR("Float: ", float_us / float(points), "us/point  Cached: ", cached_us / float(points), "us/point");
+          serialprintPGM(max_err <= 0.0001f ? PSTR("PASS") : PSTR("FAIL"));
+          SERIAL_EOL();
+        } break;
+
+      #endif
+
+      #if ENABLED(GCODE_FAST_DECIMAL)
+
+        case 114: { // D114 Fuzz the fast decimal parser against strtod
+          // S<values> sets the number of random values, up to 9999.9999999.
+          // The error must stay under one step of the finest axis.
+          uint32_t seed = 0x2545F491;
+          auto rnd = [&](const uint32_t n) {
+            seed = seed * 1664525UL + 1013904223UL;
+            return (seed >> 8) % n;
+          };
+
+          float finest = 0;
+          LOOP_XYZE(a) NOLESS(finest, planner.settings.axis_steps_per_mm[a]);
+
+          const uint16_t values = _MAX(parser.ushortval('S', 1000), uint16_t(1));
+          float max_err = 0;
+          char str[24], worst[24] = "";
+          uint32_t fast_us = 0, strtod_us = 0;
+          for (uint16_t i = 0; i < values; i++) {
+            // [-+]?[0-9]{0,4}(.[0-9]{0,7})? with at least one digit, then junk
+            char *p = str;
+            switch (rnd(4)) { case 0: *p++ = '-'; break; case 1: *p++ = '+'; break; }
+            const uint8_t ints = rnd(5), fracs = rnd(8);
+            LOOP_L_N(d, ints) *p++ = '0' + rnd(10);
+            if (fracs || !ints) {
+              *p++ = '.';
+              LOOP_L_N(d, _MAX(fracs, uint8_t(1))) *p++ = '0' + rnd(10);
+            }
+            *p++ = " *XE"[rnd(4)];
+            *p = '\0';
+
+            uint32_t us = micros();
+            const float ff = GCodeParser::decimal_value(str);
+            fast_us += micros() - us;
+            us = micros();
+            const float fs = strtod(str, nullptr);
+            strtod_us += micros() - us;
+
+            const float err = ABS(ff - fs);
+            if (err > max_err) { max_err = err; strcpy(worst, str); }
+          }
+          SERIAL_ECHOLNPAIR("Values: ", values, " Max error: ", max_err * 1000000, "nm at ", worst);
+          SERIAL_ECHOLNPAIR("strtod: ", strtod_us / float(values), "us/value  Fast: ", fast_us / float(values), "us/value");
+          serialprintPGM(max_err * finest < 1 ? PSTR("PASS") : PSTR("FAIL"));
+          SERIAL_EOL();
+        } break;
+
+      #endif
+
+      #if ENABLED(SERIAL_DMA) && defined(__PLAT_LINUX__)
+
+        case 115: { // D115 Loop bursts through the emulated RX DMA and read them back
+          // S<bursts> sets the number of bursts of 1 to RX_BUFFER_SIZE-1 bytes.
+          // Every byte must come back in order through peek() and read(),
+          // and the idle-line scan must see each one exactly once.
+          static HalSerial port;
+          port.loopback = true;
+          port.flush();
+          port.rx_idle();
+          port.rx_idle_bytes = 0;
+
+          uint32_t seed = 0x2545F491;
+          const uint16_t bursts = _MAX(parser.ushortval('S', 200), uint16_t(1));
+          uint32_t bytes = 0, errors = 0;
+          uint8_t sent = 0, expect = 0;
+          for (uint16_t i = 0; i < bursts; i++) {
+            seed = seed * 1664525UL + 1013904223UL;
+            const uint16_t len = 1 + (seed >> 8) % (RX_BUFFER_SIZE - 1);
+            for (uint16_t n = 0; n < len; n++) port.write(char(sent++));
+            port.rx_idle();
+            if (port.available() != len) errors++;
+            for (uint16_t n = 0; n < len; n++, expect++)
+              if (port.peek() != expect || port.read() != expect) errors++;
+            if (port.read() != -1) errors++;
+            bytes += len;
+          }
+          if (port.rx_idle_bytes != bytes) errors++;
+          SERIAL_ECHOLNPAIR("Bytes: ", bytes, " Wraps: ", bytes / (RX_BUFFER_SIZE), " Errors: ", errors);
+          serialprintPGM(errors ? PSTR("FAIL") : PSTR("PASS"));
+          SERIAL_EOL();
+        } break;
+
+      #endif
     }
   }
 
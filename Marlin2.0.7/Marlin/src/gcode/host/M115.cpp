@@ -67,6 +67,12 @@ void GcodeSuite::M115() {
     // BINARY_FILE_TRANSFER (M28 B1)
     cap_line(PSTR("BINARY_FILE_TRANSFER"), ENABLED(BINARY_FILE_TRANSFER));
 
+    // BINARY_GCODE_STREAM (M28 B1, G-code stream protocol)
+    cap_line(PSTR("BINARY_GCODE_STREAM"), ENABLED(BINARY_GCODE_STREAM));
+
+    // MEATPACK (packed G-code transport)
+    cap_line(PSTR("MEATPACK"), ENABLED(MEATPACK));
+
     // EEPROM (M500, M501)
     cap_line(PSTR("EEPROM"), ENABLED(EEPROM_SETTINGS));
 
@@ -41,30 +41,64 @@
 #endif
 
 /**
- * Plan an arc in 2 dimensions
+ * State of an arc being cut into linear segments
+ */
+typedef struct {
+  #if ENABLED(CNC_WORKSPACE_PLANES)
+    AxisEnum p_axis, q_axis, l_axis;
+  #endif
+  xyze_pos_t cart,                  // Destination position
+             raw;                   // Last planned position
+  ab_float_t offset,                // Center of rotation relative to the start position
+             rvec;                  // Radius vector from center to the last planned position
+  float center_P, center_Q, start_L,
+        theta_per_segment, linear_per_segment, extruder_per_segment,
+        sin_T, cos_T;               // Small angle rotation matrix
+  feedRate_t scaled_fr_mm_s;
+  #if ENABLED(SCARA_FEEDRATE_SCALING)
+    float inv_duration;
+  #endif
+  uint16_t segments, index;         // Total segments, next segment
+  #if N_ARC_CORRECTION > 1
+    int8_t arc_recalc_count;
+  #endif
+} arc_t;
+
+#if ENABLED(CNC_WORKSPACE_PLANES)
+  #define ARC_AXES(A) const AxisEnum p_axis = A.p_axis, q_axis = A.q_axis, l_axis = A.l_axis
+#else
+  constexpr AxisEnum p_axis = X_AXIS, q_axis = Y_AXIS, l_axis = Z_AXIS;
+  #define ARC_AXES(A) NOOP
+#endif
+
+/**
+ * Set up an arc in 2 dimensions from current_position
  *
  * The arc is approximated by generating many small linear segments.
  * The length of each segment is configured in MM_PER_ARC_SEGMENT (Default 1mm)
  * Arcs should only be made relatively large (over 5mm), as larger arcs with
  * larger segments will tend to be more efficient. Your slicer should have
  * options for G2/G3 arc generation. In future these options may be GCode tunable.
+ *
+ * With ARC_STREAMING the segment length is chosen by ARC_CHORD_ERROR instead.
+ *
+ * Return false if the arc is too short to move.
  */
-void plan_arc(
+static bool arc_init(
+  arc_t &arc,
   const xyze_pos_t &cart,   // Destination position
   const ab_float_t &offset, // Center of rotation relative to current_position
   const uint8_t clockwise   // Clockwise?
 ) {
   #if ENABLED(CNC_WORKSPACE_PLANES)
-    AxisEnum p_axis, q_axis, l_axis;
     switch (gcode.workspace_plane) {
       default:
-      case GcodeSuite::PLANE_XY: p_axis = X_AXIS; q_axis = Y_AXIS; l_axis = Z_AXIS; break;
-      case GcodeSuite::PLANE_YZ: p_axis = Y_AXIS; q_axis = Z_AXIS; l_axis = X_AXIS; break;
-      case GcodeSuite::PLANE_ZX: p_axis = Z_AXIS; q_axis = X_AXIS; l_axis = Y_AXIS; break;
+      case GcodeSuite::PLANE_XY: arc.p_axis = X_AXIS; arc.q_axis = Y_AXIS; arc.l_axis = Z_AXIS; break;
+      case GcodeSuite::PLANE_YZ: arc.p_axis = Y_AXIS; arc.q_axis = Z_AXIS; arc.l_axis = X_AXIS; break;
+      case GcodeSuite::PLANE_ZX: arc.p_axis = Z_AXIS; arc.q_axis = X_AXIS; arc.l_axis = Y_AXIS; break;
     }
-  #else
-    constexpr AxisEnum p_axis = X_AXIS, q_axis = Y_AXIS, l_axis = Z_AXIS;
   #endif
+  ARC_AXES(arc);
 
   // Radius vector from center to current location
   ab_float_t rvec = -offset;
@@ -99,20 +133,31 @@ void plan_arc(
 
   const float flat_mm = radius * angular_travel,
               mm_of_travel = linear_travel ? HYPOT(flat_mm, linear_travel) : ABS(flat_mm);
-  if (mm_of_travel < 0.001f) return;
+  if (mm_of_travel < 0.001f) return false;
 
   const feedRate_t scaled_fr_mm_s = MMS_SCALED(feedrate_mm_s);
 
   // Start with a nominal segment length
-  float seg_length = (
-    #ifdef ARC_SEGMENTS_PER_R
-      constrain(MM_PER_ARC_SEGMENT * radius, MM_PER_ARC_SEGMENT, ARC_SEGMENTS_PER_R)
-    #elif ARC_SEGMENTS_PER_SEC
-      _MAX(scaled_fr_mm_s * RECIPROCAL(ARC_SEGMENTS_PER_SEC), MM_PER_ARC_SEGMENT)
-    #else
-      MM_PER_ARC_SEGMENT
+  #if ENABLED(ARC_STREAMING)
+    // Longest chord that stays within ARC_CHORD_ERROR of the arc
+    float seg_length = radius > (ARC_CHORD_ERROR) * 0.5f
+      ? 2 * SQRT((ARC_CHORD_ERROR) * (2 * radius - (ARC_CHORD_ERROR)))
+      : 2 * radius;
+    #ifdef ARC_SEGMENTS_PER_SEC
+      NOLESS(seg_length, scaled_fr_mm_s * RECIPROCAL(ARC_SEGMENTS_PER_SEC)); // Don't outrun the planner
     #endif
-  );
+    LIMIT(seg_length, float(MIN_ARC_SEGMENT_MM), float(MAX_ARC_SEGMENT_MM));
+  #else
+    float seg_length = (
+      #ifdef ARC_SEGMENTS_PER_R
+        constrain(MM_PER_ARC_SEGMENT * radius, MM_PER_ARC_SEGMENT, ARC_SEGMENTS_PER_R)
+      #elif ARC_SEGMENTS_PER_SEC
+        _MAX(scaled_fr_mm_s * RECIPROCAL(ARC_SEGMENTS_PER_SEC), MM_PER_ARC_SEGMENT)
+      #else
+        MM_PER_ARC_SEGMENT
+      #endif
+    );
+  #endif
   // Divide total travel by nominal segment length
   uint16_t segments = FLOOR(mm_of_travel / seg_length);
   NOLESS(segments, min_segments);         // At least some segments
@@ -145,88 +190,107 @@ void plan_arc(
    * This is important when there are successive arc motions.
    */
   // Vector rotation matrix values
-  xyze_pos_t raw;
-  const float theta_per_segment = angular_travel / segments,
-              linear_per_segment = linear_travel / segments,
-              extruder_per_segment = extruder_travel / segments,
-              sq_theta_per_segment = sq(theta_per_segment),
-              sin_T = theta_per_segment - sq_theta_per_segment*theta_per_segment/6,
-              cos_T = 1 - 0.5f * sq_theta_per_segment; // Small angle approximation
+  arc.theta_per_segment = angular_travel / segments;
+  arc.linear_per_segment = linear_travel / segments;
+  arc.extruder_per_segment = extruder_travel / segments;
+  const float sq_theta_per_segment = sq(arc.theta_per_segment);
+  arc.sin_T = arc.theta_per_segment - sq_theta_per_segment * arc.theta_per_segment / 6;
+  arc.cos_T = 1 - 0.5f * sq_theta_per_segment; // Small angle approximation
+
+  arc.cart = cart;
+  arc.offset = offset;
+  arc.rvec = rvec;
+  arc.center_P = center_P;
+  arc.center_Q = center_Q;
+  arc.start_L = start_L;
+  arc.scaled_fr_mm_s = scaled_fr_mm_s;
 
   // Initialize the linear axis
-  raw[l_axis] = current_position[l_axis];
+  arc.raw[l_axis] = current_position[l_axis];
 
   // Initialize the extruder axis
-  raw.e = current_position.e;
+  arc.raw.e = current_position.e;
 
   #if ENABLED(SCARA_FEEDRATE_SCALING)
-    const float inv_duration = scaled_fr_mm_s / seg_length;
+    arc.inv_duration = scaled_fr_mm_s / seg_length;
   #endif
 
-  millis_t next_idle_ms = millis() + 200UL;
-
+  arc.segments = segments;
+  arc.index = 1;
   #if N_ARC_CORRECTION > 1
-    int8_t arc_recalc_count = N_ARC_CORRECTION;
+    arc.arc_recalc_count = N_ARC_CORRECTION;
   #endif
 
-  for (uint16_t i = 1; i < segments; i++) { // Iterate (segments-1) times
+  return true;
+}
 
-    thermalManager.manage_heater();
-    if (ELAPSED(millis(), next_idle_ms)) {
-      next_idle_ms = millis() + 200UL;
-      idle();
-    }
+/**
+ * Plan the next intermediate segment of an arc.
+ * Return false if the planner refused it (e.g., during a quick stop).
+ */
+static bool arc_next_segment(arc_t &arc) {
+  ARC_AXES(arc);
+  xyze_pos_t &raw = arc.raw;
+  ab_float_t &rvec = arc.rvec;
+  const uint16_t i = arc.index++;
 
+  #if N_ARC_CORRECTION > 1
+    if (--arc.arc_recalc_count) {
+      // Apply vector rotation matrix to previous rvec.a / 1
+      const float r_new_Y = rvec.a * arc.sin_T + rvec.b * arc.cos_T;
+      rvec.a = rvec.a * arc.cos_T - rvec.b * arc.sin_T;
+      rvec.b = r_new_Y;
+    }
+    else
+  #endif
+  {
     #if N_ARC_CORRECTION > 1
-      if (--arc_recalc_count) {
-        // Apply vector rotation matrix to previous rvec.a / 1
-        const float r_new_Y = rvec.a * sin_T + rvec.b * cos_T;
-        rvec.a = rvec.a * cos_T - rvec.b * sin_T;
-        rvec.b = r_new_Y;
-      }
-      else
+      arc.arc_recalc_count = N_ARC_CORRECTION;
     #endif
-    {
-      #if N_ARC_CORRECTION > 1
-        arc_recalc_count = N_ARC_CORRECTION;
-      #endif
 
-      // Arc correction to radius vector. Computed only every N_ARC_CORRECTION increments.
-      // Compute exact location by applying transformation matrix from initial radius vector(=-offset).
-      // To reduce stuttering, the sin and cos could be computed at different times.
-      // For now, compute both at the same time.
-      const float cos_Ti = cos(i * theta_per_segment), sin_Ti = sin(i * theta_per_segment);
-      rvec.a = -offset[0] * cos_Ti + offset[1] * sin_Ti;
-      rvec.b = -offset[0] * sin_Ti - offset[1] * cos_Ti;
-    }
+    // Arc correction to radius vector. Computed only every N_ARC_CORRECTION increments.
+    // Compute exact location by applying transformation matrix from initial radius vector(=-offset).
+    // To reduce stuttering, the sin and cos could be computed at different times.
+    // For now, compute both at the same time.
+    const float cos_Ti = cos(i * arc.theta_per_segment), sin_Ti = sin(i * arc.theta_per_segment);
+    rvec.a = -arc.offset[0] * cos_Ti + arc.offset[1] * sin_Ti;
+    rvec.b = -arc.offset[0] * sin_Ti - arc.offset[1] * cos_Ti;
+  }
 
-    // Update raw location
-    raw[p_axis] = center_P + rvec.a;
-    raw[q_axis] = center_Q + rvec.b;
-    #if ENABLED(AUTO_BED_LEVELING_UBL)
-      raw[l_axis] = start_L;
-      UNUSED(linear_per_segment);
-    #else
-      raw[l_axis] += linear_per_segment;
-    #endif
-    raw.e += extruder_per_segment;
+  // Update raw location
+  raw[p_axis] = arc.center_P + rvec.a;
+  raw[q_axis] = arc.center_Q + rvec.b;
+  #if ENABLED(AUTO_BED_LEVELING_UBL)
+    raw[l_axis] = arc.start_L;
+  #else
+    raw[l_axis] += arc.linear_per_segment;
+  #endif
+  raw.e += arc.extruder_per_segment;
+
+  apply_motion_limits(raw);
 
-    apply_motion_limits(raw);
+  #if HAS_LEVELING && !PLANNER_LEVELING
+    planner.apply_leveling(raw);
+  #endif
 
-    #if HAS_LEVELING && !PLANNER_LEVELING
-      planner.apply_leveling(raw);
+  return planner.buffer_line(raw, arc.scaled_fr_mm_s, active_extruder, 0
+    #if ENABLED(SCARA_FEEDRATE_SCALING)
+      , arc.inv_duration
     #endif
+  );
+}
 
-    if (!planner.buffer_line(raw, scaled_fr_mm_s, active_extruder, 0
-      #if ENABLED(SCARA_FEEDRATE_SCALING)
-        , inv_duration
-      #endif
-    )) break;
-  }
+/**
+ * Plan the last segment of an arc, ending exactly at the target,
+ * which then becomes current_position.
+ */
+static void arc_last_segment(arc_t &arc) {
+  ARC_AXES(arc);
+  xyze_pos_t &raw = arc.raw;
 
   // Ensure last segment arrives at target location.
-  raw = cart;
-  TERN_(AUTO_BED_LEVELING_UBL, raw[l_axis] = start_L);
+  raw = arc.cart;
+  TERN_(AUTO_BED_LEVELING_UBL, raw[l_axis] = arc.start_L);
 
   apply_motion_limits(raw);
 
@@ -234,17 +298,112 @@ void plan_arc(
     planner.apply_leveling(raw);
   #endif
 
-  planner.buffer_line(raw, scaled_fr_mm_s, active_extruder, 0
+  planner.buffer_line(raw, arc.scaled_fr_mm_s, active_extruder, 0
     #if ENABLED(SCARA_FEEDRATE_SCALING)
-      , inv_duration
+      , arc.inv_duration
     #endif
   );
 
-  TERN_(AUTO_BED_LEVELING_UBL, raw[l_axis] = start_L);
+  TERN_(AUTO_BED_LEVELING_UBL, raw[l_axis] = arc.start_L);
   current_position = raw;
+}
+
+/**
+ * Plan an arc in 2 dimensions, returning when every segment is in the planner
+ */
+void plan_arc(
+  const xyze_pos_t &cart,   // Destination position
+  const ab_float_t &offset, // Center of rotation relative to current_position
+  const uint8_t clockwise   // Clockwise?
+) {
+  HAL_BENCH(MOTION);
+
+  arc_t arc;
+  if (!arc_init(arc, cart, offset, clockwise)) return;
+
+  millis_t next_idle_ms = millis() + 200UL;
+
+  while (arc.index < arc.segments) { // Iterate (segments-1) times
+    thermalManager.manage_heater();
+    if (ELAPSED(millis(), next_idle_ms)) {
+      next_idle_ms = millis() + 200UL;
+      idle();
+    }
+    if (!arc_next_segment(arc)) break;
+  }
+
+  arc_last_segment(arc);
 
 } // plan_arc
 
+#if ENABLED(ARC_STREAMING)
+
+  #define ARC_STREAM_SEGMENTS_PER_LOOP 4  // Segments planned per main loop pass
+
+  static arc_t stream_arc;
+  #if ENABLED(ARC_P_CIRCLES)
+    static xyze_pos_t stream_cart;        // Target of the final arc
+    static uint8_t stream_clockwise;
+    static int8_t stream_circles;         // Full circles left before the final arc
+  #endif
+
+  /**
+   * Start streaming an arc from current_position. The main loop plans its
+   * segments with arc_stream() and holds back further commands until done.
+   */
+  static void arc_stream_start(const xyze_pos_t &cart, const ab_float_t &offset, const uint8_t clockwise) {
+    planner.arc_pending = arc_init(stream_arc, cart, offset, clockwise);
+  }
+
+  /**
+   * Called from the main loop. Plan a few more segments of the pending arc
+   * while the planner has free blocks, so it never waits here.
+   *
+   * Return true while the arc is still pending.
+   */
+  bool GcodeSuite::arc_stream() {
+    if (!planner.arc_pending) return false;
+    if (planner.is_full()) return true;
+
+    HAL_BENCH(MOTION);
+
+    for (uint8_t n = ARC_STREAM_SEGMENTS_PER_LOOP; n && planner.arc_pending && !planner.is_full(); --n) {
+      if (stream_arc.index < stream_arc.segments) {
+        // A refused segment means the motion was aborted. Drop the rest and
+        // take up the position where the planned part of the arc ended.
+        if (!arc_next_segment(stream_arc)) {
+          planner.arc_pending = false;
+          planner.synchronize();
+          set_current_from_steppers_for_axis(ALL_AXES);
+          sync_plan_position();
+        }
+        continue;
+      }
+
+      arc_last_segment(stream_arc);
+      planner.arc_pending = false;
+
+      #if ENABLED(ARC_P_CIRCLES)
+        if (stream_circles > 0) {
+          const ab_float_t offset = stream_arc.offset;
+          arc_stream_start(--stream_circles ? current_position : stream_cart, offset, stream_clockwise);
+        }
+      #endif
+    }
+
+    if (!planner.arc_pending) reset_stepper_timeout();
+    return planner.arc_pending;
+  }
+
+  /**
+   * Plan the rest of a pending arc, for commands that run out of order
+   */
+  void GcodeSuite::arc_stream_finish() {
+    while (arc_stream()) idle();
+  }
+
+#endif // ARC_STREAMING
+
 /**
  * G2: Clockwise Arc
  * G3: Counterclockwise Arc
@@ -324,12 +483,23 @@ void GcodeSuite::G2_G3(const bool clockwise) {
         if (!WITHIN(circles_to_do, 0, 100))
           SERIAL_ERROR_MSG(STR_ERR_ARC_ARGS);
 
-        while (circles_to_do--)
-          plan_arc(current_position, arc_offset, clockwise);
+        #if ENABLED(ARC_STREAMING)
+          stream_cart = destination;
+          stream_clockwise = clockwise;
+          stream_circles = circles_to_do;
+          if (circles_to_do > 0) {
+            arc_stream_start(current_position, arc_offset, clockwise);
+            reset_stepper_timeout();
+            return;
+          }
+        #else
+          while (circles_to_do--)
+            plan_arc(current_position, arc_offset, clockwise);
+        #endif
       #endif
 
       // Send the arc to the planner
-      plan_arc(destination, arc_offset, clockwise);
+      TERN(ARC_STREAMING, arc_stream_start, plan_arc)(destination, arc_offset, clockwise);
       reset_stepper_timeout();
     }
     else
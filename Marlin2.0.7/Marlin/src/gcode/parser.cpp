@@ -114,6 +114,8 @@ void GCodeParser::reset() {
 // 58 bytes of SRAM are used to speed up seen/value
 void GCodeParser::parse(char *p) {
 
+  HAL_BENCH(PARSE);
+
   reset(); // No codes to report
 
   auto uppercase = [](char c) {
@@ -341,6 +343,47 @@ void GCodeParser::parse(char *p) {
   }
 }
 
+#if ENABLED(GCODE_FAST_DECIMAL)
+
+  /**
+   * Convert a G-code value without strtod(). Up to 9 significant digits go
+   * into an integer, which is then scaled by an exact power of ten. Any
+   * further digits are dropped. With the two roundings the result is within
+   * 2 ULP of strtod(), or at most a micron for values under 10000mm.
+   */
+  float GCodeParser::decimal_value(const char *p) {
+    static const float pow10[] PROGMEM = { 1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f };
+
+    const bool neg = *p == '-';
+    if (neg || *p == '+') ++p;
+
+    uint32_t m = 0;           // Significant digits
+    uint8_t digits = 0;       // Count of significant digits in m
+    int8_t exp = 0;           // Power of ten to apply to m
+    for (; NUMERIC(*p); ++p) {
+      if (digits < 9) { m = m * 10 + (*p - '0'); if (m) ++digits; }
+      else ++exp;
+    }
+    if (*p == '.')
+      for (++p; NUMERIC(*p) && digits < 9; ++p) {
+        m = m * 10 + (*p - '0');
+        if (m) ++digits;
+        --exp;
+      }
+
+    float f = m;
+    for (; exp < -10; exp += 10) f /= 1e10f;
+    for (; exp > 10; exp -= 10) f *= 1e10f;
+    if (exp < 0)
+      f /= pgm_read_float(&pow10[-exp]);
+    else if (exp > 0)
+      f *= pgm_read_float(&pow10[exp]);
+
+    return neg ? -f : f;
+  }
+
+#endif // GCODE_FAST_DECIMAL
+
 #if ENABLED(CNC_COORDINATE_SYSTEMS)
 
   // Parse the next parameter as a new command
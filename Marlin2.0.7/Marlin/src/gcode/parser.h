@@ -253,8 +253,16 @@ public:
   // The value as a string
   static inline char* value_string() { return value_ptr; }
 
+  #if ENABLED(GCODE_FAST_DECIMAL)
+    // Convert [-+]digits[.digits], stopping at anything else
+    static float decimal_value(const char *p);
+  #endif
+
   // Float removes 'E' to prevent scientific notation interpretation
   static inline float value_float() {
+    #if ENABLED(GCODE_FAST_DECIMAL)
+      return value_ptr ? decimal_value(value_ptr) : 0;
+    #endif
     if (value_ptr) {
       char *e = value_ptr;
       for (;;) {
@@ -45,6 +45,10 @@ GCodeQueue queue;
   #include "../feature/binary_stream.h"
 #endif
 
+#if ENABLED(MEATPACK)
+  #include "../feature/meatpack.h"
+#endif
+
 #if ENABLED(POWER_LOSS_RECOVERY)
   #include "../feature/powerloss.h"
 #endif
@@ -60,6 +64,15 @@ GCodeQueue queue;
  */
 long GCodeQueue::last_N[NUM_SERIAL];
 
+/**
+ * With ADVANCED_OK a host may send lines ahead of the "ok" for earlier ones.
+ * After a "Resend:" the lines it already sent are dropped without errors
+ * until the requested line comes in again.
+ */
+#if ENABLED(ADVANCED_OK)
+  static bool resend_requested[NUM_SERIAL];
+#endif
+
 /**
  * GCode Command Queue
  * A simple ring buffer of BUFSIZE command strings.
@@ -73,7 +86,13 @@ uint8_t GCodeQueue::length = 0,  // Count of commands in the queue
         GCodeQueue::index_r = 0, // Ring buffer read position
         GCodeQueue::index_w = 0; // Ring buffer write position
 
-char GCodeQueue::command_buffer[BUFSIZE][MAX_CMD_SIZE];
+#if ENABLED(PACKED_COMMAND_QUEUE)
+  char GCodeQueue::command_buffer[PACKED_QUEUE_BYTES];
+  uint16_t GCodeQueue::command_offset[BUFSIZE],
+           GCodeQueue::write_end;
+#else
+  char GCodeQueue::command_buffer[BUFSIZE][MAX_CMD_SIZE];
+#endif
 
 /*
  * The port that the command was received on
@@ -121,6 +140,27 @@ void GCodeQueue::clear() {
   index_r = index_w = length = 0;
 }
 
+#if ENABLED(PACKED_COMMAND_QUEUE)
+
+  /**
+   * Get the ring offset where a command of up to 'need' bytes
+   * (including the terminator) can go, or -1 if there's no room.
+   * A command that won't fit before the end of the ring goes to the front.
+   * The newest command always ends short of the oldest one, so a ring
+   * that isn't empty never looks empty.
+   */
+  int16_t GCodeQueue::write_offset(const uint16_t need/*=MAX_CMD_SIZE*/) {
+    if (!length) return 0;                    // Empty. Start over at the front.
+    const uint16_t start = command_offset[index_r];
+    if (write_end > start) {                  // Commands fill [start, write_end)
+      if (PACKED_QUEUE_BYTES - write_end >= need) return write_end;
+      return start > need ? 0 : -1;
+    }
+    return start - write_end > need ? write_end : -1;
+  }
+
+#endif
+
 /**
  * Once a new command is in the ring buffer, call this to commit it
  */
@@ -131,6 +171,7 @@ void GCodeQueue::_commit_command(bool say_ok
 ) {
   send_ok[index_w] = say_ok;
   TERN_(HAS_MULTI_SERIAL, port[index_w] = p);
+  TERN_(PACKED_COMMAND_QUEUE, write_end = command_offset[index_w] + strlen(command(index_w)) + 1);
   TERN_(POWER_LOSS_RECOVERY, recovery.commit_sdpos(index_w));
   if (++index_w >= BUFSIZE) index_w = 0;
   length++;
@@ -147,7 +188,12 @@ bool GCodeQueue::_enqueue(const char* cmd, bool say_ok/*=false*/
   #endif
 ) {
   if (*cmd == ';' || length >= BUFSIZE) return false;
-  strcpy(command_buffer[index_w], cmd);
+  #if ENABLED(PACKED_COMMAND_QUEUE)
+    const int16_t w = write_offset(strlen(cmd) + 1);
+    if (w < 0) return false;
+    command_offset[index_w] = w;
+  #endif
+  strcpy(command(index_w), cmd);
   _commit_command(say_ok
     #if HAS_MULTI_SERIAL
       , pn
@@ -197,7 +243,7 @@ bool GCodeQueue::process_injected_command_P() {
   // Execute command if non-blank
   if (i) {
     parser.parse(cmd);
-    gcode.process_parsed_command();
+    gcode.process_parsed_command(false, 0);   // Not from the queue
   }
   return true;
 }
@@ -217,7 +263,7 @@ bool GCodeQueue::process_injected_command() {
   if (i) {
     injected_commands[i] = '\0';
     parser.parse(injected_commands);
-    gcode.process_parsed_command();
+    gcode.process_parsed_command(false, 0);   // Not from the queue
   }
 
   // Copy the next command into place
@@ -270,6 +316,46 @@ void GCodeQueue::enqueue_now_P(PGM_P const pgcode) {
   }
 }
 
+#if ENABLED(ADVANCED_OK)
+
+  uint8_t GCodeQueue::free_slots(uint8_t freeing) {
+    NOMORE(freeing, length);              // An empty queue has nothing to free
+    const uint8_t slots = BUFSIZE - length + freeing;
+    #if ENABLED(PACKED_COMMAND_QUEUE)
+      // Count whole MAX_CMD_SIZE lines in the contiguous free spans, as write_offset() would place them
+      uint16_t lines;
+      if (length == freeing)
+        lines = PACKED_QUEUE_BYTES / (MAX_CMD_SIZE);
+      else {
+        const uint16_t start = command_offset[(index_r + freeing) % (BUFSIZE)];
+        if (write_end > start)              // Free at the end of the ring, then before 'start'
+          lines = (PACKED_QUEUE_BYTES - write_end) / (MAX_CMD_SIZE) + (start ? (start - 1) / (MAX_CMD_SIZE) : 0);
+        else                                // Free between the newest and the oldest command
+          lines = (start - write_end - 1) / (MAX_CMD_SIZE);
+      }
+      return _MIN(uint16_t(slots), lines);
+    #else
+      return slots;
+    #endif
+  }
+
+  /**
+   * The credits a host needs to keep several lines in flight:
+   *   P<int>  Planner space remaining
+   *   B<int>  Block queue space remaining, counting 'freeing' commands
+   *           that are done but not yet removed from the queue. No more
+   *           than the lines of MAX_CMD_SIZE that fit in the RX buffer.
+   */
+  inline void print_credits(const uint8_t freeing) {
+    uint8_t b = GCodeQueue::free_slots(freeing);
+    #ifdef RX_BUFFER_SIZE
+      NOMORE(b, (RX_BUFFER_SIZE) / (MAX_CMD_SIZE));
+    #endif
+    SERIAL_ECHOPAIR_P(SP_P_STR, int(planner.moves_free()), SP_B_STR, int(b));
+  }
+
+#endif
+
 /**
  * Send an "ok" message to the host, indicating
  * that a command was successfully processed.
@@ -279,7 +365,7 @@ void GCodeQueue::enqueue_now_P(PGM_P const pgcode) {
  *   P<int>  Planner space remaining
  *   B<int>  Block queue space remaining
  */
-void GCodeQueue::ok_to_send() {
+void GCodeQueue::ok_to_send(const uint8_t freeing/*=1*/) {
   #if HAS_MULTI_SERIAL
     const int16_t pn = command_port();
     if (pn < 0) return;
@@ -288,15 +374,16 @@ void GCodeQueue::ok_to_send() {
   if (!send_ok[index_r]) return;
   SERIAL_ECHOPGM(STR_OK);
   #if ENABLED(ADVANCED_OK)
-    char* p = command_buffer[index_r];
-    if (*p == 'N') {
+    char* p = command(index_r);
+    if (freeing && *p == 'N') {           // Only the queued command has a line number
       SERIAL_ECHO(' ');
       SERIAL_ECHO(*p++);
       while (NUMERIC_SIGNED(*p))
         SERIAL_ECHO(*p++);
     }
-    SERIAL_ECHOPAIR_P(SP_P_STR, int(planner.moves_free()),
-                      SP_B_STR, int(BUFSIZE - length));
+    print_credits(freeing);
+  #else
+    UNUSED(freeing);
   #endif
   SERIAL_EOL();
 }
@@ -304,17 +391,24 @@ void GCodeQueue::ok_to_send() {
 /**
  * Send a "Resend: nnn" message to the host to
  * indicate that a command needs to be re-sent.
+ * The "ok" that follows goes with the rejected line, not the queued
+ * command, so it has no line number.
+ *
+ * With ADVANCED_OK the RX buffer isn't flushed. Flushing could cut a line
+ * the host sent ahead in two, and the tail would look like a new command.
+ * Whole lines are dropped instead until the requested one comes in.
  */
-void GCodeQueue::flush_and_request_resend() {
-  const int16_t pn = command_port();
+void GCodeQueue::flush_and_request_resend(const int16_t pn/*=command_port()*/) {
   #if HAS_MULTI_SERIAL
     if (pn < 0) return;
-    PORT_REDIRECT(pn);                    // Reply to the serial port that sent the command
+    PORT_REDIRECT(pn);                    // Reply to the serial port that sent the line
   #endif
-  SERIAL_FLUSH();
+  TERN(ADVANCED_OK, resend_requested[pn] = true, SERIAL_FLUSH());
   SERIAL_ECHOPGM(STR_RESEND);
   SERIAL_ECHOLN(last_N[pn] + 1);
-  ok_to_send();
+  SERIAL_ECHOPGM(STR_OK);
+  TERN_(ADVANCED_OK, print_credits(0));
+  SERIAL_EOL();
 }
 
 inline bool serial_data_available() {
@@ -336,8 +430,10 @@ void GCodeQueue::gcode_line_error(PGM_P const err, const int8_t pn) {
   SERIAL_ERROR_START();
   serialprintPGM(err);
   SERIAL_ECHOLN(last_N[pn]);
-  while (read_serial(pn) != -1);          // Clear out the RX buffer
-  flush_and_request_resend();
+  #if DISABLED(ADVANCED_OK)
+    while (read_serial(pn) != -1);        // Clear out the RX buffer
+  #endif
+  flush_and_request_resend(pn);
   serial_count[pn] = 0;
 }
 
@@ -352,7 +448,7 @@ FORCE_INLINE bool is_M29(const char * const cmd) {  // matches "M29" & "M29 ", b
 #define PS_PAREN  3
 #define PS_ESC    4
 
-inline void process_stream_char(const char c, uint8_t &sis, char (&buff)[MAX_CMD_SIZE], int &ind) {
+inline void process_stream_char(const char c, uint8_t &sis, char * const buff, int &ind) {
 
   if (sis == PS_EOL) return;    // EOL comment or overflow
 
@@ -404,11 +500,30 @@ inline void process_stream_char(const char c, uint8_t &sis, char (&buff)[MAX_CMD
   }
 }
 
+#if ENABLED(SD_BULK_READ)
+
+  /**
+   * Add a run of characters with no end-of-line to the command buffer.
+   * Once the rest of the line is a comment (or overflow) the run is skipped
+   * in one go. A '*' checksum ends the line the same way, so it never
+   * reaches the parser.
+   */
+  inline void process_stream_span(const char *s, uint16_t n, uint8_t &sis, char * const buff, int &ind) {
+    for (; n && sis != PS_EOL; --n, ++s) {
+      if (*s == '*' && sis == PS_NORMAL)
+        sis = PS_EOL;
+      else
+        process_stream_char(*s, sis, buff, ind);
+    }
+  }
+
+#endif
+
 /**
  * Handle a line being completed. For an empty line
  * keep sensor readings going and watchdog alive.
  */
-inline bool process_line_done(uint8_t &sis, char (&buff)[MAX_CMD_SIZE], int &ind) {
+inline bool process_line_done(uint8_t &sis, char * const buff, int &ind) {
   sis = PS_NORMAL;
   buff[ind] = 0;
   if (ind) { ind = 0; return false; }
@@ -416,6 +531,39 @@ inline bool process_line_done(uint8_t &sis, char (&buff)[MAX_CMD_SIZE], int &ind
   return true;
 }
 
+#if ENABLED(BINARY_GCODE_STREAM)
+
+  /**
+   * Queue the lines from the last binary G-code stream packet.
+   * Return true once they're all queued.
+   */
+  bool GCodeQueue::get_stream_commands() {
+    const char * const data = GCodeStreamProtocol::data;
+    const uint16_t length = GCodeStreamProtocol::length;
+    uint16_t &index = GCodeStreamProtocol::index;
+
+    while (index < length && has_space()) {
+      char * const cmd = next_command();
+      uint8_t input_state = PS_NORMAL;
+      int count = 0;
+      while (index < length) {
+        const char c = data[index++];
+        if (ISEOL(c)) break;
+        process_stream_char(c, input_state, cmd, count);
+      }
+      if (!process_line_done(input_state, cmd, count))
+        _commit_command(false
+          #if HAS_MULTI_SERIAL
+            , card.transfer_port_index
+          #endif
+        );
+    }
+
+    return index >= length;
+  }
+
+#endif
+
 /**
  * Get all commands waiting on the serial port and queue them.
  * Exit when the buffer is full or when no more characters are
@@ -425,15 +573,27 @@ void GCodeQueue::get_serial_commands() {
   static char serial_line_buffer[NUM_SERIAL][MAX_CMD_SIZE];
 
   static uint8_t serial_input_state[NUM_SERIAL] = { PS_NORMAL };
-	
+
+  // Streamed lines go ahead of anything new on the serial port
+  #if ENABLED(BINARY_GCODE_STREAM)
+    if (!get_stream_commands()) return;
+  #endif
+
   #if ENABLED(BINARY_FILE_TRANSFER)
     if (card.flag.binary_mode) {
-      /**
-       * For binary stream file transfer, use serial_line_buffer as the working
-       * receive buffer (which limits the packet size to MAX_CMD_SIZE).
-       * The receive buffer also limits the packet size for reliable transmission.
-       */
-      binaryStream[card.transfer_port_index].receive(serial_line_buffer[card.transfer_port_index]);
+      #if ENABLED(BINARY_GCODE_STREAM)
+        // Packets for the G-code stream need a bigger receive buffer
+        static char binary_packet_buffer[BINARY_STREAM_PACKET_SIZE];
+        binaryStream[card.transfer_port_index].receive(binary_packet_buffer);
+        get_stream_commands();
+      #else
+        /**
+         * For binary stream file transfer, use serial_line_buffer as the working
+         * receive buffer (which limits the packet size to MAX_CMD_SIZE).
+         * The receive buffer also limits the packet size for reliable transmission.
+         */
+        binaryStream[card.transfer_port_index].receive(serial_line_buffer[card.transfer_port_index]);
+      #endif
       return;
     }
   #endif
@@ -452,7 +612,7 @@ void GCodeQueue::get_serial_commands() {
   /**
    * Loop while serial characters are incoming and the queue is not full
    */
-  while (length < BUFSIZE && serial_data_available()) {
+  while (has_space() && serial_data_available()) {
     LOOP_L_N(i, NUM_SERIAL) {
 
       const int c = read_serial(i);
@@ -467,8 +627,6 @@ void GCodeQueue::get_serial_commands() {
 					uiCfg.serial_stable_cnt++;
 			}
 
-      const char serial_char = c;
-
 #if ENABLED(TFT_LVGL_UI)
 		  if(uiCfg.serial_stable_cnt == 500)
 			{
@@ -483,96 +641,112 @@ void GCodeQueue::get_serial_commands() {
 		  }
 #endif
 
-      if (ISEOL(serial_char)) {
+      #if ENABLED(MEATPACK)
+        // A packed byte may hold several characters, or none
+        char chars[MeatPack::kMaxChars];
+        const uint8_t char_count = meatpack[i].decode(c, chars, i);
+      #else
+        constexpr uint8_t char_count = 1;
+      #endif
 
-        // Reset our state, continue if the line was empty
-        if (process_line_done(serial_input_state[i], serial_line_buffer[i], serial_count[i]))
-          continue;
+      LOOP_L_N(char_index, char_count) {
 
-        char* command = serial_line_buffer[i];
+        const char serial_char = TERN(MEATPACK, chars[char_index], c);
 
-        while (*command == ' ') command++;                   // Skip leading spaces
-        char *npos = (*command == 'N') ? command : nullptr;  // Require the N parameter to start the line
+        if (ISEOL(serial_char)) {
 
-        if (npos) {
+          // Reset our state, continue if the line was empty
+          if (process_line_done(serial_input_state[i], serial_line_buffer[i], serial_count[i]))
+            continue;
 
-          bool M110 = strstr_P(command, PSTR("M110")) != nullptr;
+          char* command = serial_line_buffer[i];
 
-          if (M110) {
-            char* n2pos = strchr(command + 4, 'N');
-            if (n2pos) npos = n2pos;
-          }
+          while (*command == ' ') command++;                   // Skip leading spaces
+          char *npos = (*command == 'N') ? command : nullptr;  // Require the N parameter to start the line
 
-          const long gcode_N = strtol(npos + 1, nullptr, 10);
+          if (npos) {
 
-          if (gcode_N != last_N[i] + 1 && !M110)
-            return gcode_line_error(PSTR(STR_ERR_LINE_NO), i);
+            bool M110 = strstr_P(command, PSTR("M110")) != nullptr;
 
-          char *apos = strrchr(command, '*');
-          if (apos) {
-            uint8_t checksum = 0, count = uint8_t(apos - command);
-            while (count) checksum ^= command[--count];
-            if (strtol(apos + 1, nullptr, 10) != checksum)
-              return gcode_line_error(PSTR(STR_ERR_CHECKSUM_MISMATCH), i);
-          }
-          else
-            return gcode_line_error(PSTR(STR_ERR_NO_CHECKSUM), i);
+            if (M110) {
+              char* n2pos = strchr(command + 4, 'N');
+              if (n2pos) npos = n2pos;
+            }
 
-          last_N[i] = gcode_N;
-        }
-        #if ENABLED(SDSUPPORT)
-          // Pronterface "M29" and "M29 " has no line number
-          else if (card.flag.saving && !is_M29(command))
-            return gcode_line_error(PSTR(STR_ERR_NO_CHECKSUM), i);
-        #endif
+            const long gcode_N = strtol(npos + 1, nullptr, 10);
+
+            if (gcode_N != last_N[i] + 1 && !M110) {
+              if (TERN0(ADVANCED_OK, resend_requested[i])) continue;  // Sent before the host saw "Resend:"
+              return gcode_line_error(PSTR(STR_ERR_LINE_NO), i);
+            }
 
-        //
-        // Movement commands give an alert when the machine is stopped
-        //
-
-        if (IsStopped()) {
-          char* gpos = strchr(command, 'G');
-          if (gpos) {
-            switch (strtol(gpos + 1, nullptr, 10)) {
-              case 0: case 1:
-              #if ENABLED(ARC_SUPPORT)
-                case 2: case 3:
-              #endif
-              #if ENABLED(BEZIER_CURVE_SUPPORT)
-                case 5:
-              #endif
-                PORT_REDIRECT(i);                      // Reply to the serial port that sent the command
-                SERIAL_ECHOLNPGM(STR_ERR_STOPPED);
-                LCD_MESSAGEPGM(MSG_STOPPED);
-                break;
+            char *apos = strrchr(command, '*');
+            if (apos) {
+              uint8_t checksum = 0, count = uint8_t(apos - command);
+              while (count) checksum ^= command[--count];
+              if (strtol(apos + 1, nullptr, 10) != checksum)
+                return gcode_line_error(PSTR(STR_ERR_CHECKSUM_MISMATCH), i);
             }
+            else
+              return gcode_line_error(PSTR(STR_ERR_NO_CHECKSUM), i);
+
+            last_N[i] = gcode_N;
+            TERN_(ADVANCED_OK, resend_requested[i] = false);
           }
-        }
+          #if ENABLED(SDSUPPORT)
+            // Pronterface "M29" and "M29 " has no line number
+            else if (card.flag.saving && !is_M29(command))
+              return gcode_line_error(PSTR(STR_ERR_NO_CHECKSUM), i);
+          #endif
 
-        #if DISABLED(EMERGENCY_PARSER)
-          // Process critical commands early
-          if (strcmp_P(command, PSTR("M108")) == 0) {
-            wait_for_heatup = false;
-            TERN_(HAS_LCD_MENU, wait_for_user = false);
+          //
+          // Movement commands give an alert when the machine is stopped
+          //
+
+          if (IsStopped()) {
+            char* gpos = strchr(command, 'G');
+            if (gpos) {
+              switch (strtol(gpos + 1, nullptr, 10)) {
+                case 0: case 1:
+                #if ENABLED(ARC_SUPPORT)
+                  case 2: case 3:
+                #endif
+                #if ENABLED(BEZIER_CURVE_SUPPORT)
+                  case 5:
+                #endif
+                  PORT_REDIRECT(i);                      // Reply to the serial port that sent the command
+                  SERIAL_ECHOLNPGM(STR_ERR_STOPPED);
+                  LCD_MESSAGEPGM(MSG_STOPPED);
+                  break;
+              }
+            }
           }
-          if (strcmp_P(command, PSTR("M112")) == 0) kill(M112_KILL_STR, nullptr, true);
-          if (strcmp_P(command, PSTR("M410")) == 0) quickstop_stepper();
-        #endif
 
-        #if defined(NO_TIMEOUTS) && NO_TIMEOUTS > 0
-          last_command_time = ms;
-        #endif
+          #if DISABLED(EMERGENCY_PARSER)
+            // Process critical commands early
+            if (strcmp_P(command, PSTR("M108")) == 0) {
+              wait_for_heatup = false;
+              TERN_(HAS_LCD_MENU, wait_for_user = false);
+            }
+            if (strcmp_P(command, PSTR("M112")) == 0) kill(M112_KILL_STR, nullptr, true);
+            if (strcmp_P(command, PSTR("M410")) == 0) quickstop_stepper();
+          #endif
 
-        // Add the command to the queue
-        _enqueue(serial_line_buffer[i], true
-          #if HAS_MULTI_SERIAL
-            , i
+          #if defined(NO_TIMEOUTS) && NO_TIMEOUTS > 0
+            last_command_time = ms;
           #endif
-        );
-      }
-      else
-        process_stream_char(serial_char, serial_input_state[i], serial_line_buffer[i], serial_count[i]);
 
+          // Add the command to the queue
+          _enqueue(serial_line_buffer[i], true
+            #if HAS_MULTI_SERIAL
+              , i
+            #endif
+          );
+        }
+        else
+          process_stream_char(serial_char, serial_input_state[i], serial_line_buffer[i], serial_count[i]);
+
+      } // char_count
     } // for NUM_SERIAL
   } // queue has space, serial has data
 }
@@ -593,18 +767,47 @@ void GCodeQueue::get_serial_commands() {
     int sd_count = 0;
     bool card_eof = card.eof();
 		uiCfg.serial_stable_cnt = 0;
-    while (length < BUFSIZE && !card_eof) {
+
+    #if ENABLED(SD_BULK_READ)
+
+      while (has_space() && !card_eof) {
+        uint16_t n;
+        bool is_eol;
+        const char * const span = card.get_span(n, is_eol);
+        card_eof = card.eof();
+        if (!span) { SERIAL_ERROR_MSG(STR_SD_ERR_READ); continue; }
+
+        char * const cmd = next_command();
+        process_stream_span(span, n, sd_input_state, cmd, sd_count);
+
+        if (is_eol || card_eof) {
+          // Reset stream state, terminate the buffer, and commit a non-empty command
+          if (!process_line_done(sd_input_state, cmd, sd_count)) {
+            _commit_command(false);
+            #if ENABLED(POWER_LOSS_RECOVERY)
+              recovery.cmd_sdpos = card.getIndex();   // Prime for the NEXT _commit_command
+            #endif
+          }
+
+          if (card_eof) card.fileHasFinished();       // Handle end of file reached
+        }
+      }
+
+    #else
+
+    while (has_space() && !card_eof) {
       const int16_t n = card.get();
       card_eof = card.eof();
       if (n < 0 && !card_eof) { SERIAL_ERROR_MSG(STR_SD_ERR_READ); continue; }
 
       const char sd_char = (char)n;
       const bool is_eol = ISEOL(sd_char);
+      char * const cmd = next_command();
       if (is_eol || card_eof) {
 
         // Reset stream state, terminate the buffer, and commit a non-empty command
         if (!is_eol && sd_count) ++sd_count;          // End of file with no newline
-        if (!process_line_done(sd_input_state, command_buffer[index_w], sd_count)) {
+        if (!process_line_done(sd_input_state, cmd, sd_count)) {
           _commit_command(false);
           #if ENABLED(POWER_LOSS_RECOVERY)
             recovery.cmd_sdpos = card.getIndex();     // Prime for the NEXT _commit_command
@@ -614,9 +817,11 @@ void GCodeQueue::get_serial_commands() {
         if (card_eof) card.fileHasFinished();         // Handle end of file reached
       }
       else
-        process_stream_char(sd_char, sd_input_state, command_buffer[index_w], sd_count);
+        process_stream_char(sd_char, sd_input_state, cmd, sd_count);
 
     }
+
+    #endif
   }
 
 #endif // SDSUPPORT
@@ -639,6 +844,11 @@ void GCodeQueue::get_available_commands() {
  */
 void GCodeQueue::advance() {
 
+  // Feed a streaming arc to the planner before anything else runs
+  #if ENABLED(ARC_STREAMING)
+    if (gcode.arc_stream()) return;
+  #endif
+
   // Process immediate commands
   if (process_injected_command_P() || process_injected_command()) return;
 
@@ -648,7 +858,7 @@ void GCodeQueue::advance() {
   #if ENABLED(SDSUPPORT)
 
     if (card.flag.saving) {
-      char* command = command_buffer[index_r];
+      char* command = GCodeQueue::command(index_r);
       if (is_M29(command)) {
         // M29 closes the file
         card.closefile();
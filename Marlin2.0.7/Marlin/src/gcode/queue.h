@@ -46,11 +46,36 @@ public:
    * (immediate, serial, sd card) and they are processed sequentially by
    * the main loop. The gcode.process_next_command method parses the next
    * command and hands off execution to individual handler functions.
+   *
+   * With PACKED_COMMAND_QUEUE the strings are stored end to end in a ring of
+   * PACKED_QUEUE_BYTES. A command never wraps, so it is always contiguous.
    */
   static uint8_t length,  // Count of commands in the queue
                  index_r; // Ring buffer read position
 
-  static char command_buffer[BUFSIZE][MAX_CMD_SIZE];
+  #if ENABLED(PACKED_COMMAND_QUEUE)
+    static char command_buffer[PACKED_QUEUE_BYTES];
+    static uint16_t command_offset[BUFSIZE];  // Start of each command in the ring
+    static inline char* command(const uint8_t i) { return &command_buffer[command_offset[i]]; }
+  #else
+    static char command_buffer[BUFSIZE][MAX_CMD_SIZE];
+    static inline char* command(const uint8_t i) { return command_buffer[i]; }
+  #endif
+
+  /**
+   * Is there room for one more command of any length?
+   */
+  static inline bool has_space() {
+    return length < BUFSIZE && TERN1(PACKED_COMMAND_QUEUE, write_offset() >= 0);
+  }
+
+  #if ENABLED(ADVANCED_OK)
+    /**
+     * How many more commands of any length can be queued,
+     * counting the oldest 'freeing' commands as gone
+     */
+    static uint8_t free_slots(uint8_t freeing);
+  #endif
 
   /**
    * The port that the command was received on
@@ -138,21 +163,42 @@ public:
    *   N<int>  Line number of the command, if any
    *   P<int>  Planner space remaining
    *   B<int>  Block queue space remaining
+   *
+   * 'freeing' is 1 when the command is the queued one at index_r, which
+   * leaves the queue next, and 0 for injected commands.
    */
-  static void ok_to_send();
+  static void ok_to_send(const uint8_t freeing=1);
 
   /**
    * Clear the serial line and request a resend of
    * the next expected line number.
    */
-  static void flush_and_request_resend();
+  static void flush_and_request_resend(const int16_t pn=command_port());
 
 private:
 
   static uint8_t index_w;  // Ring buffer write position
 
+  #if ENABLED(PACKED_COMMAND_QUEUE)
+    static uint16_t write_end;  // End of the newest command in the ring
+    static int16_t write_offset(const uint16_t need=MAX_CMD_SIZE);
+  #endif
+
+  /**
+   * The buffer for the next command, with room for MAX_CMD_SIZE.
+   * Only valid when has_space() is true.
+   */
+  static inline char* next_command() {
+    TERN_(PACKED_COMMAND_QUEUE, command_offset[index_w] = write_offset());
+    return command(index_w);
+  }
+
   static void get_serial_commands();
 
+  #if ENABLED(BINARY_GCODE_STREAM)
+    static bool get_stream_commands();
+  #endif
+
   #if ENABLED(SDSUPPORT)
     static void get_sdcard_commands();
   #endif
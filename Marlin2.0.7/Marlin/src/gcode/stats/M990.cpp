@@ -0,0 +1,44 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(STEPPER_ISR_PROFILING)
+
+#include "../gcode.h"
+#include "../../feature/stepper_profiler.h"
+
+/**
+ * M990: Report Stepper ISR cycle statistics
+ *
+ *   R  Reset the statistics after reporting
+ *
+ * Per-phase cycle counts (pulse, advance, block) and the whole ISR,
+ * the ISR share of the CPU, the number of times max_loops ran out
+ * and a histogram of ISR durations.
+ */
+void GcodeSuite::M990() {
+  stepper_profiler.report();
+  if (parser.seen('R')) stepper_profiler.reset();
+}
+
+#endif // STEPPER_ISR_PROFILING
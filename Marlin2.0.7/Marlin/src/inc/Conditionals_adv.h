@@ -225,6 +225,10 @@
   #endif
 #endif
 
+#if ENABLED(SERIAL_DMA) && SERIAL_DMA_TX_SIZE
+  #define HAS_SERIAL_DMA_TX 1
+#endif
+
 #if ENABLED(HOST_ACTION_COMMANDS)
   #ifndef ACTION_ON_PAUSE
     #define ACTION_ON_PAUSE   "pause"
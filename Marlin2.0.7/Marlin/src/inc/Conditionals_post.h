@@ -2405,6 +2405,12 @@
 #if ENABLED(SEGMENT_LEVELED_MOVES) && !defined(LEVELED_SEGMENT_LENGTH)
   #define LEVELED_SEGMENT_LENGTH 5
 #endif
+#if ENABLED(SDIO_READ_AHEAD) && !defined(SDIO_READ_AHEAD_BLOCKS)
+  #define SDIO_READ_AHEAD_BLOCKS 4
+#endif
+#if ENABLED(MESH_BED_LEVELING) && !defined(MBL_MAX_ERROR)
+  #define MBL_MAX_ERROR 0.005
+#endif
 
 /**
  * Default mesh area is an area with an inset margin on the print area.
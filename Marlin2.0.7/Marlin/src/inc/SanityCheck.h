@@ -587,6 +587,8 @@
     #error "SERIAL_XON_XOFF requires RX_BUFFER_SIZE >= 1024 for reliable transfers without drops."
   #elif RX_BUFFER_SIZE && (RX_BUFFER_SIZE < 2 || !IS_POWER_OF_2(RX_BUFFER_SIZE))
     #error "RX_BUFFER_SIZE must be a power of 2 greater than 1."
+  #elif ENABLED(ADVANCED_OK) && RX_BUFFER_SIZE < MAX_CMD_SIZE
+    #error "ADVANCED_OK requires RX_BUFFER_SIZE >= MAX_CMD_SIZE, so at least one whole line can be in flight."
   #elif TX_BUFFER_SIZE && (TX_BUFFER_SIZE < 2 || TX_BUFFER_SIZE > 256 || !IS_POWER_OF_2(TX_BUFFER_SIZE))
     #error "TX_BUFFER_SIZE must be 0 or a power of 2 between 1 and 256."
   #endif
@@ -594,6 +596,10 @@
   #error "SERIAL_XON_XOFF and SERIAL_STATS_* features not supported on USB-native AVR devices."
 #endif
 
+#if ENABLED(SERIAL_DMA) && !defined(__STM32F1__) && !defined(__PLAT_LINUX__)
+  #error "SERIAL_DMA is only available for STM32F1 (and the LINUX simulator)."
+#endif
+
 #ifndef SERIAL_PORT
   #error "SERIAL_PORT must be defined in Configuration.h"
 #elif defined(SERIAL_PORT_2) && SERIAL_PORT_2 == SERIAL_PORT
@@ -1200,6 +1206,8 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
  */
 #if HAS_JUNCTION_DEVIATION && IS_KINEMATIC
   #error "CLASSIC_JERK is required for DELTA and SCARA."
+#elif ENABLED(JD_USE_FACTOR_TABLE) && !HAS_JUNCTION_DEVIATION
+  #error "JD_USE_FACTOR_TABLE requires Junction Deviation. Disable CLASSIC_JERK or JD_USE_FACTOR_TABLE."
 #endif
 
 /**
@@ -1452,6 +1460,17 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
 
 #endif
 
+#if ENABLED(ABL_BILINEAR_CACHE)
+  #if DISABLED(AUTO_BED_LEVELING_BILINEAR)
+    #error "ABL_BILINEAR_CACHE requires AUTO_BED_LEVELING_BILINEAR."
+  #endif
+  static_assert(ABL_BILINEAR_MAX_ERROR > 0, "ABL_BILINEAR_MAX_ERROR must be greater than 0.");
+#endif
+
+#if ENABLED(MESH_BED_LEVELING)
+  static_assert(MBL_MAX_ERROR > 0, "MBL_MAX_ERROR must be greater than 0.");
+#endif
+
 #if HAS_MESH && HAS_CLASSIC_JERK
   static_assert(DEFAULT_ZJERK > 0.1, "Low DEFAULT_ZJERK values are incompatible with mesh-based leveling.");
 #endif
@@ -3159,6 +3178,93 @@ static_assert(   _ARR_TEST(3,0) && _ARR_TEST(3,1) && _ARR_TEST(3,2)
   #error "DIRECT_STEPPING is incompatible with LIN_ADVANCE. Enable in external planner if possible."
 #endif
 
+/**
+ * Stepper ISR Profiling
+ */
+#if ENABLED(STEPPER_ISR_PROFILING)
+  #if !defined(__PLAT_LINUX__) && !(defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__))
+    #error "STEPPER_ISR_PROFILING requires a Cortex-M3/M4/M7 (DWT cycle counter) or HAL/LINUX."
+  #elif !WITHIN(STEPPER_ISR_HISTOGRAM_US, 1, 100)
+    #error "STEPPER_ISR_HISTOGRAM_US must be from 1 to 100."
+  #endif
+#endif
+
+/**
+ * Step pulse DMA
+ */
+#if ENABLED(STEP_PULSE_DMA)
+  #ifndef __STM32F1__
+    #error "STEP_PULSE_DMA is only supported on STM32F1."
+  #elif ENABLED(DISABLE_MULTI_STEPPING)
+    #error "STEP_PULSE_DMA requires multi-stepping. Disable DISABLE_MULTI_STEPPING."
+  #elif ANY(DIRECT_STEPPING, MIXING_EXTRUDER, SQUARE_WAVE_STEPPING, I2S_STEPPER_STREAM)
+    #error "STEP_PULSE_DMA is not compatible with DIRECT_STEPPING, MIXING_EXTRUDER, SQUARE_WAVE_STEPPING, or I2S_STEPPER_STREAM."
+  #elif ANY(X_DUAL_STEPPER_DRIVERS, Y_DUAL_STEPPER_DRIVERS, DUAL_X_CARRIAGE) || NUM_Z_STEPPER_DRIVERS > 1
+    #error "STEP_PULSE_DMA requires one stepper per axis."
+  #elif E_STEPPERS > 1 && DISABLED(LIN_ADVANCE)
+    #error "STEP_PULSE_DMA requires a single E stepper (or LIN_ADVANCE)."
+  #elif !WITHIN(STEP_PULSE_DMA_EVENTS, 2, 128)
+    #error "STEP_PULSE_DMA_EVENTS must be from 2 to 128."
+  #endif
+#endif
+
+/**
+ * SDIO Read-Ahead
+ */
+#if ENABLED(SDIO_READ_AHEAD)
+  #if ENABLED(SDIO_SUPPORT) && !defined(__STM32F1__)
+    #error "SDIO_READ_AHEAD is only supported on STM32F1."
+  #elif !WITHIN(SDIO_READ_AHEAD_BLOCKS, 2, 16) || (SDIO_READ_AHEAD_BLOCKS) % 2
+    #error "SDIO_READ_AHEAD_BLOCKS must be an even number from 2 to 16."
+  #endif
+#endif
+
+/**
+ * Packed command queue
+ */
+#if ENABLED(PACKED_COMMAND_QUEUE)
+  #if PACKED_QUEUE_BYTES < 2 * (MAX_CMD_SIZE)
+    #error "PACKED_QUEUE_BYTES must be at least 2 * MAX_CMD_SIZE."
+  #elif PACKED_QUEUE_BYTES > 32767
+    #error "PACKED_QUEUE_BYTES must be 32767 or less."
+  #endif
+#endif
+
+/**
+ * SD bulk read
+ */
+#if ENABLED(SD_BULK_READ)
+  #if !WITHIN(SD_BULK_READ_SIZE, 32, 512) || ((SD_BULK_READ_SIZE) & ((SD_BULK_READ_SIZE) - 1))
+    #error "SD_BULK_READ_SIZE must be a power of 2 from 32 to 512."
+  #endif
+#endif
+
+/**
+ * Binary G-code stream
+ */
+#if ENABLED(BINARY_GCODE_STREAM)
+  #if DISABLED(BINARY_FILE_TRANSFER)
+    #error "BINARY_GCODE_STREAM requires BINARY_FILE_TRANSFER."
+  #elif !WITHIN(BINARY_STREAM_PACKET_SIZE, MAX_CMD_SIZE, 4096)
+    #error "BINARY_STREAM_PACKET_SIZE must be from MAX_CMD_SIZE to 4096."
+  #elif BINARY_STREAM_WINDOW < 1
+    #error "BINARY_STREAM_WINDOW must be 1 or more."
+  #elif !IS_AT90USB && RX_BUFFER_SIZE < (BINARY_STREAM_WINDOW) * ((BINARY_STREAM_PACKET_SIZE) + 10) // 8-byte header + 2-byte footer
+    #error "BINARY_GCODE_STREAM requires RX_BUFFER_SIZE >= BINARY_STREAM_WINDOW * (BINARY_STREAM_PACKET_SIZE + 10)."
+  #endif
+#endif
+
+/**
+ * Arc streaming
+ */
+#if ENABLED(ARC_STREAMING)
+  #if DISABLED(ARC_SUPPORT)
+    #error "ARC_STREAMING requires ARC_SUPPORT."
+  #endif
+  static_assert(ARC_CHORD_ERROR > 0, "ARC_CHORD_ERROR must be greater than 0.");
+  static_assert(MIN_ARC_SEGMENT_MM > 0 && MIN_ARC_SEGMENT_MM <= MAX_ARC_SEGMENT_MM, "MIN_ARC_SEGMENT_MM must be from 0 to MAX_ARC_SEGMENT_MM.");
+#endif
+
 /**
  * Touch Buttons
  */
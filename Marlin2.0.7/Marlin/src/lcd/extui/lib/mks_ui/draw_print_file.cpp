@@ -163,6 +163,136 @@ uint8_t have_pre_pic(char *path)
     return 0;
 }
 
+#if HAS_THUMB_CACHE_IN_FLASH && ENABLED(SDSUPPORT)
+
+#define PRE_PIC_SIZE 100  // Pixels per side of the ";simage:" thumbnail
+
+// Files whose thumbnail is cut short or malformed, so a page visit doesn't
+// erase a cache slot for them again
+static uint32_t pre_pic_bad_tag[FILE_NUM];
+static uint8_t pre_pic_bad_count, pre_pic_bad_next;
+
+static bool pre_pic_is_bad(const uint32_t tag)
+{
+    for(uint8_t i = 0; i < pre_pic_bad_count; i++)
+        if(pre_pic_bad_tag[i] == tag) return true;
+    return false;
+}
+
+static void pre_pic_set_bad(const uint32_t tag)
+{
+    pre_pic_bad_tag[pre_pic_bad_next] = tag;
+    if(++pre_pic_bad_next == FILE_NUM) pre_pic_bad_next = 0;
+    if(pre_pic_bad_count < FILE_NUM) pre_pic_bad_count++;
+}
+
+// Identify a file by its path, size and modification time
+static bool pre_pic_tag(char *path, uint32_t &tag)
+{
+    SdFile file, *curDir;
+    dir_t entry;
+    const char * const fname = card.diveToFile(false, curDir, strrchr(path, '/'));
+    if(!fname || !file.open(curDir, fname, O_READ)) return false;
+    const bool ok = file.dirEntry(&entry);
+    file.close();
+    if(!ok) return false;
+
+    // FNV-1a
+    tag = 2166136261UL;
+    auto mix = [&](const uint8_t b) { tag = (tag ^ b) * 16777619UL; };
+    for(const char *p = path; *p; p++) mix(*p);
+    const uint32_t stamp[] = { entry.fileSize, (uint32_t)entry.lastWriteDate << 16 | entry.lastWriteTime };
+    for(uint8_t i = 0; i < sizeof(stamp); i++) mix(((uint8_t *)stamp)[i]);
+    return true;
+}
+
+// Decode the file's ";simage:" thumbnail into a cache slot. -1 if it has none or it's broken.
+static int16_t pre_pic_cache_fill(char *path, const uint32_t tag)
+{
+    static const char key[] = ";simage:";
+    uint16_t row_buf[PRE_PIC_SIZE];
+    int16_t slot = -1;
+    uint16_t row = 0, col = 0, pixel = 0;
+    uint8_t match = 0, byte = 0, digits = 0;
+    uint32_t pos = 0;
+
+    card.openFileRead(strrchr(path, '/'));
+
+    while(row < PRE_PIC_SIZE) {
+        const int16_t br = card.read(public_buf, sizeof(public_buf));
+        if(br <= 0) break;
+        // Like have_pre_pic(), give up if the first 1K has no thumbnail
+        if(slot < 0 && pos >= 1024) break;
+        pos += br;
+        for(int16_t i = 0; i < br && row < PRE_PIC_SIZE; i++) {
+            const uint8_t c = public_buf[i];
+            if(c == '\n' || c == '\r') {
+                match = 0;
+                continue;
+            }
+            if(match < sizeof(key) - 1) {
+                // Compare the line start against the key, 0xFF when it differs
+                match = (c == key[match]) ? match + 1 : 0xFF;
+                if(match == sizeof(key) - 1 && slot < 0) {
+                    slot = thumb_cache_begin();
+                    uint8_t header[4] = { 0x04, 0x90, 0x81, 0x0C };  // As sd_read_cb() gives
+                    thumb_cache_write(header, sizeof(header));
+                }
+                continue;
+            }
+            if(match == 0xFF) continue;
+
+            byte = byte << 4 | preview_hex(c);
+            if(++digits & 1) continue;
+            if(digits == 2) { pixel = byte; continue; }
+            digits = 0;
+            pixel |= byte << 8;
+            row_buf[col] = pixel ? pixel : LV_COLOR_BACKGROUND.full;
+            if(++col == PRE_PIC_SIZE) {
+                thumb_cache_write((uint8_t *)row_buf, sizeof(row_buf));
+                col = 0;
+                row++;
+                match = 0xFF;  // Skip the rest of the line
+            }
+        }
+        watchdog_refresh();
+    }
+    card.closefile();
+
+    if(slot < 0) return -1;
+    if(row < PRE_PIC_SIZE) {
+        thumb_cache_abort();  // An unfinished slot stays empty
+        pre_pic_set_bad(tag);
+        return -1;
+    }
+    thumb_cache_commit(slot, tag);
+    return slot;
+}
+
+#endif // HAS_THUMB_CACHE_IN_FLASH && SDSUPPORT
+
+// Set the LVGL source for the file's thumbnail. False if it has none.
+static bool pre_pic_src(char *path, char *src)
+{
+#if HAS_THUMB_CACHE_IN_FLASH && ENABLED(SDSUPPORT)
+    uint32_t tag;
+    if(pre_pic_tag(path, tag)) {
+        if(pre_pic_is_bad(tag)) return false;
+        int16_t slot = thumb_cache_find(tag);
+        if(slot < 0) slot = pre_pic_cache_fill(path, tag);
+        if(slot < 0) return false;
+        thumb_cache_pic_name(slot, src);
+        return true;
+    }
+#endif
+    if(!have_pre_pic(path)) return false;
+    strcpy(src, "S:");
+    strcat(src, path);
+    char *temp = strstr(src, ".GCO");
+    if(temp) strcpy(temp, ".bin");
+    return true;
+}
+
 static void event_handler(lv_obj_t * obj, lv_event_t event)
 {
     uint8_t i, file_count = 0;
@@ -399,17 +529,11 @@ void disp_gcode_icon(uint8_t file_num)
                 lv_label_set_text(labelPageUp[i], public_buf_m);
                 lv_obj_align(labelPageUp[i], buttonGcode[i], LV_ALIGN_IN_BOTTOM_MID, 0, 0);
             } else {
-                if(have_pre_pic((char *)list_file.file_name[i])) {
+                ZERO(test_public_buf_l);
+                if(pre_pic_src((char *)list_file.file_name[i], test_public_buf_l)) {
 
                     //lv_obj_set_event_cb_mks(buttonGcode[i], event_handler, (i + 1), list_file.file_name[i], 1);
 
-                    ZERO(test_public_buf_l);
-                    strcat(test_public_buf_l, "S:");
-                    strcat(test_public_buf_l, list_file.file_name[i]);
-                    char *temp = strstr(test_public_buf_l, ".GCO");
-                    if(temp) {
-                        strcpy(temp, ".bin");
-                    }
                     lv_obj_set_event_cb_mks(buttonGcode[i], event_handler, (i + 1), NULL, 0);
                     lv_imgbtn_set_src(buttonGcode[i], LV_BTN_STATE_REL, test_public_buf_l);
                     lv_imgbtn_set_src(buttonGcode[i], LV_BTN_STATE_PR, test_public_buf_l);
@@ -57,6 +57,8 @@ extern void lv_gcode_file_read(uint8_t *data_buf);
 extern void lv_close_gcode_file();
 extern void cutFileName(char *path, int len, int bytePerLine,  char *outStr);
 extern int ascii2dec_test(char *ascii);
+// ascii2dec_test() without the branches, for the thumbnail decoders
+static inline uint8_t preview_hex(const uint8_t c) { return (c & 0x0F) + (c >> 6) * 9; }
 extern void lv_clear_print_file();
 extern void lv_gcode_file_seek(uint32_t pos);
 
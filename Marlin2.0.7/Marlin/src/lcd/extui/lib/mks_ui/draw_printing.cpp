@@ -73,6 +73,24 @@ static uint8_t pre_option_state = IDLE;
 #define MSPEED_ICON_XPOINT 195
 #define MSPEED_TEXT_XPOINT (MSPEED_ICON_XPOINT+50)	
 
+// Values on the screen, so labels that would not change are neither
+// formatted nor redrawn. lv_draw_printing() fills it with values that
+// never occur, to draw everything once.
+static struct {
+  int16_t ext[2][2];  // Temperature and target
+  int16_t bed[2];
+  int16_t fan, move, flow, rate;
+  uint32_t time;
+} shown;
+
+// Store now in last. True if that changed it.
+template<typename T>
+static inline bool changed(T &last, const T now) {
+  if (last == now) return false;
+  last = now;
+  return true;
+}
+
 uint8_t once_flag = 0;
 extern uint32_t To_pre_view;
 extern uint8_t flash_preview_begin;
@@ -342,6 +360,7 @@ void lv_draw_printing(void) {
   lv_label_set_text(bar1ValueText,"0%");
   lv_obj_align(bar1ValueText, bar1, LV_ALIGN_CENTER, 0, 0);
 
+  memset(&shown, 0x80, sizeof(shown));
   disp_ext_temp();
   disp_bed_temp();
   disp_fan_speed();
@@ -396,63 +415,69 @@ void disp_print_state(){
 }
 
 void disp_ext_temp() {
-  ZERO(public_buf_l);
-  sprintf_P(public_buf_l, PSTR("%d℃/%d℃"), (int)thermalManager.temp_hotend[0].celsius, (int)thermalManager.temp_hotend[0].target);
-  lv_label_set_text(labelExt1, public_buf_l);
+  const int16_t t0 = thermalManager.temp_hotend[0].celsius, g0 = thermalManager.temp_hotend[0].target;
+  if (changed(shown.ext[0][0], t0) | changed(shown.ext[0][1], g0)) {
+    sprintf_P(public_buf_l, PSTR("%d℃/%d℃"), t0, g0);
+    lv_label_set_text(labelExt1, public_buf_l);
+  }
 
   #if HAS_MULTI_EXTRUDER
-    ZERO(public_buf_l);
-		sprintf_P(public_buf_l, PSTR("%d℃/%d℃"), (int)thermalManager.temp_hotend[1].celsius, (int)thermalManager.temp_hotend[1].target);
-    lv_label_set_text(labelExt2, public_buf_l);
+    const int16_t t1 = thermalManager.temp_hotend[1].celsius, g1 = thermalManager.temp_hotend[1].target;
+    if (changed(shown.ext[1][0], t1) | changed(shown.ext[1][1], g1)) {
+      sprintf_P(public_buf_l, PSTR("%d℃/%d℃"), t1, g1);
+      lv_label_set_text(labelExt2, public_buf_l);
+    }
   #endif
 }
 
 void disp_bed_temp() {
   #if HAS_HEATED_BED
-    ZERO(public_buf_l);
-    sprintf_P(public_buf_l, PSTR("%d℃/%d℃"), (int)thermalManager.temp_bed.celsius, (int)thermalManager.temp_bed.target);
-    lv_label_set_text(labelBed, public_buf_l);
+    const int16_t t = thermalManager.temp_bed.celsius, g = thermalManager.temp_bed.target;
+    if (changed(shown.bed[0], t) | changed(shown.bed[1], g)) {
+      sprintf_P(public_buf_l, PSTR("%d℃/%d℃"), t, g);
+      lv_label_set_text(labelBed, public_buf_l);
+    }
   #endif
 }
 
 void disp_fan_speed() {
-  ZERO(public_buf_l);
-    sprintf_P(public_buf_l, PSTR("%3d"), ((thermalManager.fan_speed[0]*100+128)/255)%101);
+  const int16_t f = ((thermalManager.fan_speed[0] * 100 + 128) / 255) % 101;
+  if (!changed(shown.fan, f)) return;
+  sprintf_P(public_buf_l, PSTR("%3d"), f);
   lv_label_set_text(labelFan, public_buf_l);
 }
 
 void disp_print_time() {
-  ZERO(public_buf_l);
   #if BOTH(LCD_SET_PROGRESS_MANUALLY, USE_M73_REMAINING_TIME)
     const uint32_t r = ui.get_remaining_time();
+    if (!changed(shown.time, r / 60)) return;
     sprintf_P(public_buf_l, PSTR("%02d:%02d R"), r / 3600, (r % 3600) / 60);
   #else
+    if (!changed(shown.time, uint32_t(print_time.hours) * 3600 + print_time.minutes * 60 + print_time.seconds)) return;
     sprintf_P(public_buf_l, PSTR("%d%d:%d%d:%d%d"), print_time.hours / 10, print_time.hours % 10, print_time.minutes / 10, print_time.minutes % 10, print_time.seconds / 10, print_time.seconds % 10);
   #endif
   lv_label_set_text(labelTime, public_buf_l);
 }
 
 void disp_fan_Zpos() {
-  ZERO(public_buf_l);
   sprintf_P(public_buf_l, PSTR("%.3f"), current_position[Z_AXIS]);
-  lv_label_set_text(labelZpos, public_buf_l);
+  lv_label_set_text_changed(labelZpos, public_buf_l);
 }
 
 void disp_move_Speed() {
-	ZERO(public_buf_l);
-	sprintf_P(public_buf_l, PSTR("%d%%"), feedrate_percentage);
+  if (!changed(shown.move, feedrate_percentage)) return;
+  sprintf_P(public_buf_l, PSTR("%d%%"), feedrate_percentage);
   lv_label_set_text(labelMSpeed, public_buf_l);
 }
 
-void disp_move_speed_mms(){
-		ZERO(public_buf_l);
-		sprintf_P(public_buf_l, PSTR("%4.1fmm/s"), MMS_SCALED(feedrate_mm_s));
-		lv_label_set_text(labelMSpeedMMS, public_buf_l);
+void disp_move_speed_mms() {
+  sprintf_P(public_buf_l, PSTR("%4.1fmm/s"), MMS_SCALED(feedrate_mm_s));
+  lv_label_set_text_changed(labelMSpeedMMS, public_buf_l);
 }
 
 void disp_extru_Speed() {
-	ZERO(public_buf_l);
-	sprintf_P(public_buf_l, PSTR("%d%%"), planner.flow_percentage[0]);
+  if (!changed(shown.flow, planner.flow_percentage[0])) return;
+  sprintf_P(public_buf_l, PSTR("%d%%"), planner.flow_percentage[0]);
   lv_label_set_text(labelESpeed, public_buf_l);
 }
 
@@ -489,9 +514,8 @@ void setProBarRate() {
 
   if (rate <= 0) return;
 
-  if (disp_state == PRINTING_UI) {
+  if (disp_state == PRINTING_UI && changed(shown.rate, (int16_t)rate)) {
     lv_bar_set_value(bar1, rate, LV_ANIM_ON);
-    ZERO(public_buf_l);
     sprintf_P(public_buf_l, "%d%%", rate);
     lv_label_set_text(bar1ValueText,public_buf_l);
     lv_obj_align(bar1ValueText, bar1, LV_ALIGN_CENTER, 0, 0);
@@ -454,6 +454,14 @@ void titleText_cat(char *str, int strSize, char *addPart)
     strcat(str, addPart);
 }
 
+// Set the text only if it differs. LVGL redraws a label on every set.
+void lv_label_set_text_changed(lv_obj_t *label, const char *text)
+{
+    const char *cur = lv_label_get_text(label);
+    if(cur && strcmp(cur, text) == 0) return;
+    lv_label_set_text(label, text);
+}
+
 char *getDispText(int index)
 {
 
@@ -956,6 +964,8 @@ void Draw_default_preview(int xpos_pixel, int ypos_pixel, uint8_t sel)
 
 void disp_pre_gcode(int xpos_pixel, int ypos_pixel)
 {
+    // The last LVGL part may still be going out of bmp_public_buf
+    while(SPI_TFT.tftio.isBusy()) {};
     if(gcode_preview_over == 1) gcode_preview(list_file.file_name[sel_id], xpos_pixel, ypos_pixel);
 #if HAS_BAK_VIEW_IN_FLASH
     if(flash_preview_begin == 1) {
@@ -992,11 +1002,18 @@ void print_time_run()
 
 void GUI_RefreshPage()
 {
-    if((systick_uptime_millis % 1000) == 0) {
+    // The loop can miss or repeat any given millisecond, so go by elapsed time
+    static millis_t next_status_ms = 0, next_rate_ms = 0;
+    const millis_t ms = millis();
+    if(ELAPSED(ms, next_status_ms)) {
+        next_status_ms = ms + 1000;
         temperature_change_frequency = 1;
         return_printui_chk = 1;
     }
-    if((systick_uptime_millis % 3000) == 0) printing_rate_update_flag = 1;
+    if(ELAPSED(ms, next_rate_ms)) {
+        next_rate_ms = ms + 3000;
+        printing_rate_update_flag = 1;
+    }
 
     if(disp_state == HAND_HEAT_UI || disp_state == OPERATE_UI || disp_state == CHANGE_SPEED_UI
        || disp_state == FAN_UI || disp_state == FILAMENTCHANGE_UI || disp_state == PRINTING_UI) {
@@ -586,6 +586,7 @@ extern void get_gcode_command(int addr, uint8_t *d);
 extern void disp_pre_gcode(int xpos_pixel, int ypos_pixel);
 #endif
 extern void GUI_RefreshPage();
+extern void lv_label_set_text_changed(lv_obj_t *label, const char *text);
 extern void clear_cur_ui();
 extern void draw_return_ui();
 extern void sd_detection();
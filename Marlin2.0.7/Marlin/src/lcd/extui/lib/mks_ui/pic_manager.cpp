@@ -44,6 +44,7 @@ extern unsigned char bmp_public_buf[];
   extern char *createFilename(char * const buffer, const dir_t &p);
 #endif
 
+// Keep in strcasecmp order. lv_get_pic_addr() does a binary search.
 static const char assets[][LONG_FILENAME_LENGTH] = 
 {
 	"bmp_about.bin",
@@ -71,10 +72,10 @@ static const char assets[][LONG_FILENAME_LENGTH] =
 	"bmp_extruct_sel.bin",
 	"bmp_fan.bin",
 	"bmp_fan_state.bin",
-	"bmp_filamentchange.bin",
-	"bmp_filamentchange_dis.bin",
 	"bmp_filament_off.bin",
 	"bmp_filament_on.bin",
+	"bmp_filamentchange.bin",
+	"bmp_filamentchange_dis.bin",
 	"bmp_file.bin",
 	"bmp_gradient.bin",
 	"bmp_heatbas.bin",
@@ -83,10 +84,10 @@ static const char assets[][LONG_FILENAME_LENGTH] =
 	"bmp_led_color.bin",
 	"bmp_led_off.bin",
 	"bmp_led_white.bin",
+	"bmp_level_set.bin",
 	"bmp_leveling.bin",
 	"bmp_leveling_auto.bin",
 	"bmp_leveling_manual.bin",
-	"bmp_level_set.bin",
 	"bmp_logo.bin",
 	"bmp_machine_para.bin",
 	"bmp_machine_para_dis.bin",
@@ -96,6 +97,8 @@ static const char assets[][LONG_FILENAME_LENGTH] =
 	"bmp_motor_off.bin",
 	"bmp_motor_off_cn.bin",
 	"bmp_mov.bin",
+	"bmp_mov_changeSpeed.bin",
+	"bmp_mov_sel.bin",
 	"bmp_move_clear.bin",
 	"bmp_move_xAdd.bin",
 	"bmp_move_xDec.bin",
@@ -103,8 +106,6 @@ static const char assets[][LONG_FILENAME_LENGTH] =
 	"bmp_move_yDec.bin",
 	"bmp_move_zAdd.bin",
 	"bmp_move_zDec.bin",
-	"bmp_mov_changeSpeed.bin",
-	"bmp_mov_sel.bin",
 	"bmp_mspeed.bin",
 	"bmp_mspeed_mms.bin",
 	"bmp_operate.bin",
@@ -113,8 +114,8 @@ static const char assets[][LONG_FILENAME_LENGTH] =
 	"bmp_pageUp.bin",
 	"bmp_pause.bin",
 	"bmp_plog.bin",
-	"bmp_preHeat.bin",
 	"bmp_pre_cool.bin",
+	"bmp_preHeat.bin",
 	"bmp_printing.bin",
 	"bmp_resume.bin",
 	"bmp_return.bin",
@@ -162,13 +163,183 @@ static const char assets[][LONG_FILENAME_LENGTH] =
 
 uint8_t currentFlashPage = 0;
 
-uint32_t lv_get_pic_addr(uint8_t *Pname) {
-  uint8_t Pic_cnt;
-  uint8_t i, j;
-  PIC_MSG PIC;
-  uint32_t tmp_cnt = 0;
-  uint32_t addr = 0;
+/**
+ * Picture index
+ *
+ * The flash keeps the pictures' names as a list of strings, in the order
+ * UpdateAssets stored them. Scanning it byte by byte on every image open
+ * made each screen change cost thousands of SPI reads. Instead, the list is
+ * read once in bulk and each known asset's slot is kept in RAM.
+ * Pic_Info_Write keeps the index current while UpdateAssets stores icons.
+ */
+static struct {
+  bool loaded;
+  uint8_t count;                  // Pictures in flash
+  uint32_t names_end;             // Name list offset for the next name
+  uint8_t slot[COUNT(assets)];    // Flash slot of each asset, 0xFF if absent
+} pic_index;
+
+static int16_t assetIndex(const char * const name) {
+  int16_t lo = 0, hi = COUNT(assets) - 1;
+  while (lo <= hi) {
+    const int16_t mid = (lo + hi) / 2;
+    const int c = strcasecmp(name, assets[mid]);
+    if (c == 0) return mid;
+    if (c < 0) hi = mid - 1; else lo = mid + 1;
+  }
+  return -1;
+}
+
+// Read the name list in blocks and pass each slot and name to fn.
+// Returns the offset just past the last name.
+template<typename F>
+static uint32_t forEachPicName(const uint8_t count, F fn) {
+  uint8_t buf[64];
+  char name[PIC_NAME_MAX_LEN];
+  uint8_t slot = 0, len = 0;
+  uint32_t offset = 0;
+  while (slot < count && offset < PIC_SIZE_ADDR - PIC_NAME_ADDR) {
+    W25QXX.SPI_FLASH_BufferRead(buf, PIC_NAME_ADDR + offset, sizeof(buf));
+    for (uint8_t i = 0; i < sizeof(buf) && slot < count; i++) {
+      offset++;
+      if (buf[i]) {
+        if (len < PIC_NAME_MAX_LEN - 1) name[len++] = buf[i];
+        continue;
+      }
+      name[len] = '\0';
+      fn(slot++, name);
+      len = 0;
+    }
+  }
+  return offset;
+}
+
+static uint8_t picCount() {
+  uint8_t count;
+  W25QXX.SPI_FLASH_BufferRead(&count, PIC_COUNTER_ADDR, 1);
+  return count == 0xFF ? 0 : count;
+}
+
+static void picIndexReset() {
+  pic_index.count = 0;
+  pic_index.names_end = 0;
+  memset(pic_index.slot, 0xFF, sizeof(pic_index.slot));
+  pic_index.loaded = true;
+}
+
+static void picIndexLoad() {
+  picIndexReset();
+  pic_index.count = picCount();
+  pic_index.names_end = forEachPicName(pic_index.count, [](const uint8_t slot, const char * const name) {
+    const int16_t a = assetIndex(name);
+    if (a >= 0) pic_index.slot[a] = slot;
+  });
+}
+
+static uint32_t picAddress(const uint8_t slot) {
+  if ((DeviceCode == 0x9488) || (DeviceCode == 0x5761))
+    return PIC_DATA_ADDR_TFT35 + slot * PER_PIC_MAX_SPACE_TFT35;
+  else
+    return PIC_DATA_ADDR_TFT32 + slot * PER_PIC_MAX_SPACE_TFT32;
+}
+
+#if HAS_THUMB_CACHE_IN_FLASH
+
+  /**
+   * Thumbnail cache
+   *
+   * Each slot holds one decoded file list thumbnail, written through
+   * SPIFlash so the "F:" driver reads it like any other picture. The key
+   * record goes in the last bytes of the slot, after the picture, so a slot
+   * cut short by a reset just reads as empty.
+   *
+   * A hit only updates the RAM copy of the use order, sparing the flash a
+   * write on every page view. After a restart slots age in write order.
+   */
+  #define THUMB_CACHE_MAGIC 0x31424854  // "THB1"
+  #define THUMB_CACHE_NAME  "thumb_"
+
+  struct thumb_record { uint32_t magic, tag, seq; };
+
+  static struct {
+    bool loaded;
+    uint32_t clock;
+    uint32_t tag[THUMB_CACHE_SLOTS];
+    uint32_t used[THUMB_CACHE_SLOTS];   // Clock at the last use, 0 if empty
+  } thumb_index;
+
+  static uint32_t thumbAddress(const int16_t slot) { return THUMB_CACHE_ADDR + uint32_t(slot) * THUMB_CACHE_SLOT_SIZE; }
+  static uint32_t thumbRecordAddress(const int16_t slot) { return thumbAddress(slot + 1) - sizeof(thumb_record); }
+
+  static void thumbIndexLoad() {
+    thumb_index.clock = 0;
+    LOOP_L_N(i, THUMB_CACHE_SLOTS) {
+      thumb_record r;
+      W25QXX.SPI_FLASH_BufferRead((uint8_t*)&r, thumbRecordAddress(i), sizeof(r));
+      const bool valid = r.magic == THUMB_CACHE_MAGIC && r.seq != 0xFFFFFFFF;
+      thumb_index.tag[i] = r.tag;
+      thumb_index.used[i] = valid ? r.seq : 0;
+      NOLESS(thumb_index.clock, thumb_index.used[i]);
+    }
+    thumb_index.loaded = true;
+  }
 
+  static int16_t thumbSlotByName(const char * const name) {
+    if (strncmp_P(name, PSTR(THUMB_CACHE_NAME), strlen(THUMB_CACHE_NAME))) return -1;
+    const int16_t slot = atoi(name + strlen(THUMB_CACHE_NAME));
+    return WITHIN(slot, 0, THUMB_CACHE_SLOTS - 1) ? slot : -1;
+  }
+
+  // Slot holding the thumbnail with this tag, or -1
+  int16_t thumb_cache_find(const uint32_t tag) {
+    W25QXX.init(SPI_QUARTER_SPEED);
+    if (!thumb_index.loaded) thumbIndexLoad();
+    LOOP_L_N(i, THUMB_CACHE_SLOTS)
+      if (thumb_index.used[i] && thumb_index.tag[i] == tag) {
+        thumb_index.used[i] = ++thumb_index.clock;
+        return i;
+      }
+    return -1;
+  }
+
+  // Erase the empty or least recently used slot and start writing to it
+  int16_t thumb_cache_begin() {
+    W25QXX.init(SPI_QUARTER_SPEED);
+    if (!thumb_index.loaded) thumbIndexLoad();
+    int16_t slot = 0;
+    LOOP_S_L_N(i, 1, THUMB_CACHE_SLOTS)
+      if (thumb_index.used[i] < thumb_index.used[slot]) slot = i;
+    thumb_index.used[slot] = 0;
+    for (uint32_t offset = 0; offset < THUMB_CACHE_SLOT_SIZE; offset += 4096) {
+      watchdog_refresh();
+      W25QXX.SPI_FLASH_SectorErase(thumbAddress(slot) + offset);
+    }
+    SPIFlash.beginWrite(thumbAddress(slot));
+    return slot;
+  }
+
+  void thumb_cache_write(uint8_t *data, uint16_t size) { SPIFlash.writeData(data, size); }
+
+  // Finish the picture and make the slot findable
+  void thumb_cache_commit(const int16_t slot, const uint32_t tag) {
+    SPIFlash.endWrite();
+    thumb_record r = { THUMB_CACHE_MAGIC, tag, ++thumb_index.clock };
+    W25QXX.SPI_FLASH_BufferWrite((uint8_t*)&r, thumbRecordAddress(slot), sizeof(r));
+    thumb_index.tag[slot] = tag;
+    thumb_index.used[slot] = r.seq;
+  }
+
+  // Drop a picture that can't be finished. The slot stays empty.
+  void thumb_cache_abort() { SPIFlash.endWrite(); }
+
+  // LVGL source for a slot's picture
+  void thumb_cache_pic_name(const int16_t slot, char *name) {
+    sprintf_P(name, PSTR("F:/" THUMB_CACHE_NAME "%03i.bin"), slot);
+  }
+
+#endif // HAS_THUMB_CACHE_IN_FLASH
+
+uint32_t lv_get_pic_addr(uint8_t *Pname) {
   currentFlashPage = 0;
 
   #if ENABLED(MARLIN_DEV_MODE)
@@ -177,25 +348,23 @@ uint32_t lv_get_pic_addr(uint8_t *Pname) {
 
   W25QXX.init(SPI_QUARTER_SPEED);
 
-  W25QXX.SPI_FLASH_BufferRead(&Pic_cnt, PIC_COUNTER_ADDR, 1);
-  if (Pic_cnt == 0xFF) Pic_cnt = 0;
-  for (i = 0; i < Pic_cnt; i++) {
-    j = 0;
-    do {
-      W25QXX.SPI_FLASH_BufferRead(&PIC.name[j], PIC_NAME_ADDR + tmp_cnt, 1);
-      tmp_cnt++;
-    } while (PIC.name[j++] != '\0');
+  #if HAS_THUMB_CACHE_IN_FLASH
+    const int16_t t = thumbSlotByName((const char*)Pname);
+    if (t >= 0) return thumbAddress(t);
+  #endif
 
-    if ((strcasecmp((char*)Pname, (char*)PIC.name)) == 0) {
-      if ((DeviceCode == 0x9488) || (DeviceCode == 0x5761))
-        addr = PIC_DATA_ADDR_TFT35 + i * PER_PIC_MAX_SPACE_TFT35;
-      else
-        addr = PIC_DATA_ADDR_TFT32 + i * PER_PIC_MAX_SPACE_TFT32;
-      return addr;
-    }
-  }
+  if (!pic_index.loaded) picIndexLoad();
 
-  return addr;
+  const int16_t a = assetIndex((const char*)Pname);
+  if (a >= 0)
+    return pic_index.slot[a] == 0xFF ? 0 : picAddress(pic_index.slot[a]);
+
+  // Not a known asset. Look through the names in flash.
+  int16_t found = -1;
+  forEachPicName(pic_index.count, [&](const uint8_t slot, const char * const name) {
+    if (found < 0 && strcasecmp((char*)Pname, name) == 0) found = slot;
+  });
+  return found < 0 ? 0 : picAddress(found);
 }
 
 const char *assetsPath = "assets";
@@ -204,6 +373,7 @@ const char *bakPath = "_assets";
 void spiFlashErase_PIC() {
   volatile uint32_t pic_sectorcnt = 0;
   W25QXX.init(SPI_QUARTER_SPEED);
+  picIndexReset();
   //erase 0x001000 -64K
   for (pic_sectorcnt = 0; pic_sectorcnt < (64 - 4) / 4; pic_sectorcnt++) {
     watchdog_refresh();
@@ -268,47 +438,25 @@ void default_view_Write(uint8_t *default_view__Rbuff, uint32_t default_view_Writ
 }
 
 uint32_t Pic_Info_Write(uint8_t *P_name, uint32_t P_size) {
-  uint8_t pic_counter = 0;
-  uint32_t Pic_SaveAddr;
-  uint32_t Pic_SizeSaveAddr;
-  uint32_t Pic_NameSaveAddr;
-  uint8_t Pname_temp;
-  uint32_t i, j;
-  uint32_t name_len = 0;
-  uint32_t SaveName_len = 0;
   union union32 size_tmp;
 
-  W25QXX.SPI_FLASH_BufferRead(&pic_counter, PIC_COUNTER_ADDR, 1);
+  if (!pic_index.loaded) picIndexLoad();
 
-  if (pic_counter == 0xFF)
-    pic_counter = 0;
+  const uint8_t pic_counter = pic_index.count;
+  const uint32_t Pic_SaveAddr = picAddress(pic_counter);
 
-  if ((DeviceCode == 0x9488) || (DeviceCode == 0x5761))
-    Pic_SaveAddr = PIC_DATA_ADDR_TFT35 + pic_counter * PER_PIC_MAX_SPACE_TFT35;
-  else
-    Pic_SaveAddr = PIC_DATA_ADDR_TFT32 + pic_counter * PER_PIC_MAX_SPACE_TFT32;
-
-  for (j = 0; j < pic_counter; j++) {
-    do {
-      W25QXX.SPI_FLASH_BufferRead(&Pname_temp, PIC_NAME_ADDR + SaveName_len, 1);
-      SaveName_len++;
-    } while (Pname_temp != '\0');
-  }
-  i = 0;
-  while ((*(P_name + i) != '\0')) {
-    i++;
-    name_len++;
-  }
-
-  Pic_NameSaveAddr = PIC_NAME_ADDR + SaveName_len;
-  W25QXX.SPI_FLASH_BufferWrite(P_name, Pic_NameSaveAddr, name_len + 1);
-  Pic_SizeSaveAddr = PIC_SIZE_ADDR + 4 * pic_counter;
+  const uint32_t name_len = strlen((char*)P_name);
+  W25QXX.SPI_FLASH_BufferWrite(P_name, PIC_NAME_ADDR + pic_index.names_end, name_len + 1);
   size_tmp.dwords = P_size;
-  W25QXX.SPI_FLASH_BufferWrite(size_tmp.bytes, Pic_SizeSaveAddr, 4);
+  W25QXX.SPI_FLASH_BufferWrite(size_tmp.bytes, PIC_SIZE_ADDR + 4 * pic_counter, 4);
+
+  pic_index.count++;
+  pic_index.names_end += name_len + 1;
+  const int16_t a = assetIndex((char*)P_name);
+  if (a >= 0) pic_index.slot[a] = pic_counter;
 
-  pic_counter++;
   W25QXX.SPI_FLASH_SectorErase(PIC_COUNTER_ADDR);
-  W25QXX.SPI_FLASH_BufferWrite(&pic_counter, PIC_COUNTER_ADDR, 1);
+  W25QXX.SPI_FLASH_BufferWrite(&pic_index.count, PIC_COUNTER_ADDR, 1);
 
   return Pic_SaveAddr;
 }
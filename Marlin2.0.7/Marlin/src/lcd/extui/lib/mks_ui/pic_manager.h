@@ -118,6 +118,14 @@
 
 #endif
 
+// Decoded G-code thumbnails for the file list, above the fonts
+#ifndef HAS_THUMB_CACHE_IN_FLASH
+  #define HAS_THUMB_CACHE_IN_FLASH      (SPI_FLASH_SIZE >= 0x1000000)
+#endif
+#define THUMB_CACHE_ADDR                0x800000
+#define THUMB_CACHE_SLOTS               100
+#define THUMB_CACHE_SLOT_SIZE           (24*1024)  // 100*100*2 + header, compressed worst case, and the key
+
 // Flash flag
 #define REFLSHE_FLGA_ADD                (0X800000-32)
 
@@ -166,6 +174,15 @@ extern void spi_flash_read_test();
 extern void default_view_Read(uint8_t *default_view_Rbuff, uint32_t default_view_Readsize);
 extern void flash_view_Read(uint8_t *flash_view_Rbuff, uint32_t flash_view_Readsize);
 
+#if HAS_THUMB_CACHE_IN_FLASH
+  extern int16_t thumb_cache_find(uint32_t tag);
+  extern int16_t thumb_cache_begin();
+  extern void thumb_cache_write(uint8_t *data, uint16_t size);
+  extern void thumb_cache_commit(int16_t slot, uint32_t tag);
+  extern void thumb_cache_abort();
+  extern void thumb_cache_pic_name(int16_t slot, char *name);
+#endif
+
 #ifdef __cplusplus
   } /* C-declarations for C++ */
 #endif
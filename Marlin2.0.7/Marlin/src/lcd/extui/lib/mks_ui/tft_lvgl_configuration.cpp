@@ -142,7 +142,12 @@ void tft_lvgl_init()
 
     lv_init();
 
+#if TFT_HAS_ASYNC_DMA
+    // Two 5-line halves: LVGL draws into one while the DMA sends the other
+    lv_disp_buf_init(&disp_buf, bmp_public_buf, (lv_color_t *)bmp_public_buf + LV_HOR_RES_MAX * 5, LV_HOR_RES_MAX * 5);
+#else
     lv_disp_buf_init(&disp_buf, bmp_public_buf, NULL, LV_HOR_RES_MAX * 10); /*Initialize the display buffer*/
+#endif
 
     lv_disp_drv_t disp_drv;     /*Descriptor of a display driver*/
     lv_disp_drv_init(&disp_drv);    /*Basic initialization*/
@@ -222,20 +227,32 @@ void tft_lvgl_init()
     lv_draw_ready_print();
 }
 
+#if TFT_HAS_ASYNC_DMA
+static lv_disp_drv_t *flushing_disp;
+static void my_disp_flush_done() { lv_disp_flush_ready(flushing_disp); }
+#endif
+
 void my_disp_flush(lv_disp_drv_t * disp, const lv_area_t * area, lv_color_t * color_p)
 {
-    uint16_t i, width, height;
+    uint16_t width, height;
 
     width = area->x2 - area->x1 + 1;
     height = area->y2 - area->y1 + 1;
 
+    // Waits for the previous part, if it is still going out
     SPI_TFT.setWindow((uint16_t)area->x1, (uint16_t)area->y1, width, height);
-    for(i = 0; i < height; i++) {
+#if TFT_HAS_ASYNC_DMA
+    // LVGL goes on drawing into the other half. The DMA interrupt marks this one free.
+    flushing_disp = disp;
+    SPI_TFT.tftio.io.WriteSequence_DMA((uint16_t*)color_p, width * height, my_disp_flush_done);
+#else
+    for(uint16_t i = 0; i < height; i++) {
         SPI_TFT.tftio.WriteSequence((uint16_t*)(color_p + width * i), width);
     }
     lv_disp_flush_ready(disp);       /* Indicate you are ready with the flushing*/
 
     W25QXX.init(SPI_QUARTER_SPEED);
+#endif
 }
 
 #define TICK_CYCLE 1
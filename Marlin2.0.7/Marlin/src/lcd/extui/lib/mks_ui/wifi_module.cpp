@@ -1675,7 +1675,7 @@ void wifi_rcv_handle() {
       if (wifiTransError.flag != 0x1) WIFI_IO1_RESET();
       getDataF = 1;
     }
-    if (need_ok_later &&  (queue.length < BUFSIZE)) {
+    if (need_ok_later && queue.has_space()) {
       need_ok_later = false;
       send_to_wifi((char *)"ok\r\n", strlen("ok\r\n"));
     }
@@ -1845,9 +1845,16 @@ void get_wifi_commands() {
   static char wifi_line_buffer[MAX_CMD_SIZE];
   static bool wifi_comment_mode = false;
   static int wifi_read_count = 0;
+  static bool wifi_line_pending = false; // A whole line that didn't fit in the queue yet
 
   if (espGcodeFifo.wait_tick > 5) {
-    while ((queue.length < BUFSIZE) && (espGcodeFifo.r != espGcodeFifo.w)) {
+    // Retry the held line before taking more from the FIFO
+    if (wifi_line_pending) {
+      if (!queue.enqueue_one_P(wifi_line_buffer)) return;
+      wifi_line_pending = false;
+    }
+
+    while (queue.has_space() && (espGcodeFifo.r != espGcodeFifo.w)) {
 
       espGcodeFifo.wait_tick = 0;
 
@@ -1899,8 +1906,11 @@ void get_wifi_commands() {
           if (strcmp(command, "M410") == 0) quickstop_stepper();
         #endif
 
-        // Add the command to the queue
-        queue.enqueue_one_P(wifi_line_buffer);
+        // Add the command to the queue, or hold it until there's room
+        if (!queue.enqueue_one_P(wifi_line_buffer)) {
+          wifi_line_pending = true;
+          break;
+        }
       }
       else if (wifi_read_count >= MAX_CMD_SIZE - 1) {
 
@@ -115,6 +115,57 @@
 // fewer movements. The delay is measured in milliseconds, and must be less than 250ms
 #define BLOCK_DELAY_FOR_1ST_MOVE 100
 
+#if ENABLED(JD_USE_FACTOR_TABLE)
+
+  /**
+   * Junction Deviation factor table
+   *
+   * With s = sin(theta/2) = SQRT(0.5 * (1 - cos(theta))) the junction limit is
+   *
+   *   vmax_junction_sqr = accel * JD * s / (1 - s) = accel * JD * 2 * s * (1 + s) / (1 + cos(theta))
+   *
+   * because (1 - s) * (1 + s) = 0.5 * (1 + cos(theta)). The factor s * (1 + s)
+   * is smooth and bounded (0..2) over the whole cosine range, so it can be
+   * interpolated from a small table, leaving one divide and no SQRT per junction.
+   * s * (1 + s) is concave in cos(theta) so the interpolation never overestimates.
+   *
+   * Acceleration and JD (M205 J) are linear in the limit, so they stay runtime
+   * multipliers and the table never needs to be rebuilt.
+   */
+  #define JD_FACTOR_STEPS 32  // Table entries per unit of cos(theta)
+
+  // Newton iteration for SQRT(x), x in [0..1], evaluated by the compiler
+  static constexpr float jd_sqrt(const float x, const float g=1.0f, const uint8_t n=24) {
+    return x == 0.0f ? 0.0f : n == 0 ? g : jd_sqrt(x, 0.5f * (g + x / g), n - 1);
+  }
+  // s * (1 + s) with s = sin(theta/2), at cos(theta) = I / JD_FACTOR_STEPS - 1
+  static constexpr float jd_factor(const uint8_t i) {
+    return jd_sqrt(1.0f - float(i) / (2 * JD_FACTOR_STEPS)) + 1.0f - float(i) / (2 * JD_FACTOR_STEPS);
+  }
+
+  #define _JDF(I)   jd_factor(I)
+  #define _JDF4(I)  _JDF(I), _JDF((I)+1), _JDF((I)+2), _JDF((I)+3)
+  #define _JDF16(I) _JDF4(I), _JDF4((I)+4), _JDF4((I)+8), _JDF4((I)+12)
+
+  static constexpr float jd_factor_table[2 * JD_FACTOR_STEPS + 1] PROGMEM = {
+    _JDF16(0), _JDF16(16), _JDF16(32), _JDF16(48), _JDF(64)
+  };
+
+  #undef _JDF
+  #undef _JDF4
+  #undef _JDF16
+
+  // Interpolated s * (1 + s) for cos(theta) in [-1..1)
+  static inline float junction_factor(const float cos_theta) {
+    const float t = (cos_theta + 1.0f) * JD_FACTOR_STEPS;
+    const uint8_t i = _MIN(uint8_t(t), 2 * JD_FACTOR_STEPS - 1);
+    const float f0 = pgm_read_float(&jd_factor_table[i]),
+                f1 = pgm_read_float(&jd_factor_table[i + 1]);
+    return f0 + (f1 - f0) * (t - i);
+  }
+
+#endif
+
 Planner planner;
 
 // public:
@@ -130,6 +181,10 @@ volatile uint8_t Planner::block_buffer_head,    // Index of the next block to be
 uint16_t Planner::cleaning_buffer_counter;      // A counter to disable queuing of blocks
 uint8_t Planner::delay_before_delivering;       // This counter delays delivery of blocks when queue becomes empty to allow the opportunity of merging blocks
 
+#if ENABLED(ARC_STREAMING)
+  bool Planner::arc_pending;                    // An arc is still being fed to the planner
+#endif
+
 planner_settings_t Planner::settings;           // Initialized by settings.load()
 
 #if ENABLED(LASER_POWER_INLINE)
@@ -765,6 +820,50 @@ block_t* Planner::get_current_block() {
   return nullptr;
 }
 
+/**
+ * Get the acceleration and plateau step counts for a trapezoid using float math.
+ *
+ * If accelerate_steps + decelerate_steps exceed step_event_count the nominal
+ * rate can't be reached and there will be no cruising. Use intersection_distance()
+ * to calculate accel / braking time in order to reach the final_rate exactly at
+ * the end of the block.
+ */
+bool Planner::trapezoid_steps_float(uint32_t &accelerate_steps, uint32_t &plateau_steps,
+  const uint32_t initial_rate, const uint32_t final_rate, const uint32_t nominal_rate, const uint32_t accel, const uint32_t step_event_count
+) {
+  // Steps required for acceleration, deceleration to/from nominal rate
+  const uint32_t decelerate_steps = FLOOR(estimate_acceleration_distance(nominal_rate, final_rate, -int32_t(accel)));
+  accelerate_steps = CEIL(estimate_acceleration_distance(initial_rate, nominal_rate, accel));
+  // Steps between acceleration and deceleration, if any
+  const int32_t plateau = step_event_count - accelerate_steps - decelerate_steps;
+  if (plateau >= 0) { plateau_steps = plateau; return true; }
+
+  const float accelerate_steps_float = CEIL(intersection_distance(initial_rate, final_rate, accel, step_event_count));
+  accelerate_steps = _MIN(uint32_t(_MAX(accelerate_steps_float, 0)), step_event_count);
+  plateau_steps = 0;
+  return false;
+}
+
+/**
+ * Get the acceleration and plateau step counts for a trapezoid using integer math.
+ * The results match trapezoid_steps_float() except where float rounding differs
+ * by a step. Avoids soft-float divisions and square roots on MCUs without an FPU.
+ */
+bool Planner::trapezoid_steps_fixed(uint32_t &accelerate_steps, uint32_t &plateau_steps,
+  const uint32_t initial_rate, const uint32_t final_rate, const uint32_t nominal_rate, const uint32_t accel, const uint32_t step_event_count
+) {
+  accelerate_steps = acceleration_steps_ceil(initial_rate, nominal_rate, accel);
+  const uint32_t decelerate_steps = acceleration_steps_floor(final_rate, nominal_rate, accel);
+  if (uint64_t(accelerate_steps) + decelerate_steps <= step_event_count) {
+    plateau_steps = step_event_count - accelerate_steps - decelerate_steps;
+    return true;
+  }
+
+  accelerate_steps = _MIN(intersection_steps_ceil(initial_rate, final_rate, accel, step_event_count), step_event_count);
+  plateau_steps = 0;
+  return false;
+}
+
 /**
  * Calculate trapezoid parameters, multiplying the entry- and exit-speeds
  * by the provided factors.
@@ -790,35 +889,27 @@ void Planner::calculate_trapezoid_for_block(block_t* const block, const float &e
 
   const int32_t accel = block->acceleration_steps_per_s2;
 
-          // Steps required for acceleration, deceleration to/from nominal rate
-  uint32_t accelerate_steps = CEIL(estimate_acceleration_distance(initial_rate, block->nominal_rate, accel)),
-           decelerate_steps = FLOOR(estimate_acceleration_distance(block->nominal_rate, final_rate, -accel));
-          // Steps between acceleration and deceleration, if any
-  int32_t plateau_steps = block->step_event_count - accelerate_steps - decelerate_steps;
-
-  // Does accelerate_steps + decelerate_steps exceed step_event_count?
-  // Then we can't possibly reach the nominal rate, there will be no cruising.
-  // Use intersection_distance() to calculate accel / braking time in order to
-  // reach the final_rate exactly at the end of this block.
-  if (plateau_steps < 0) {
-    const float accelerate_steps_float = CEIL(intersection_distance(initial_rate, final_rate, accel, block->step_event_count));
-    accelerate_steps = _MIN(uint32_t(_MAX(accelerate_steps_float, 0)), block->step_event_count);
-    plateau_steps = 0;
-
-    #if ENABLED(S_CURVE_ACCELERATION)
-      // We won't reach the cruising rate. Let's calculate the speed we will reach
-      cruise_rate = final_speed(initial_rate, accel, accelerate_steps);
-    #endif
-  }
+  uint32_t accelerate_steps, plateau_steps;
+  const bool cruising = TERN(PLANNER_FIXED_POINT_TRAPEZOID, trapezoid_steps_fixed, trapezoid_steps_float)
+                          (accelerate_steps, plateau_steps, initial_rate, final_rate, block->nominal_rate, accel, block->step_event_count);
+
   #if ENABLED(S_CURVE_ACCELERATION)
-    else // We have some plateau time, so the cruise rate will be the nominal rate
-      cruise_rate = block->nominal_rate;
+    // With some plateau time the cruise rate will be the nominal rate.
+    // Otherwise we won't reach the cruising rate. Let's calculate the speed we will reach.
+    cruise_rate = cruising ? block->nominal_rate : TERN(PLANNER_FIXED_POINT_TRAPEZOID, final_rate_fixed, final_speed)(initial_rate, accel, accelerate_steps);
+  #else
+    UNUSED(cruising);
   #endif
 
   #if ENABLED(S_CURVE_ACCELERATION)
     // Jerk controlled speed requires to express speed versus time, NOT steps
-    uint32_t acceleration_time = ((float)(cruise_rate - initial_rate) / accel) * (STEPPER_TIMER_RATE),
-             deceleration_time = ((float)(cruise_rate - final_rate) / accel) * (STEPPER_TIMER_RATE),
+    #if ENABLED(PLANNER_FIXED_POINT_TRAPEZOID)
+      uint32_t acceleration_time = udiv_floor(uint64_t(cruise_rate - initial_rate) * (STEPPER_TIMER_RATE), accel),
+               deceleration_time = cruise_rate > final_rate ? udiv_floor(uint64_t(cruise_rate - final_rate) * (STEPPER_TIMER_RATE), accel) : 0,
+    #else
+      uint32_t acceleration_time = ((float)(cruise_rate - initial_rate) / accel) * (STEPPER_TIMER_RATE),
+               deceleration_time = ((float)(cruise_rate - final_rate) / accel) * (STEPPER_TIMER_RATE),
+    #endif
     // And to offload calculations from the ISR, we also calculate the inverse of those times here
              acceleration_time_inverse = get_period_inverse(acceleration_time),
              deceleration_time_inverse = get_period_inverse(deceleration_time);
@@ -1130,11 +1221,21 @@ void Planner::forward_pass() {
  * Recalculate the trapezoid speed profiles for all blocks in the plan
  * according to the entry_factor for each junction. Must be called by
  * recalculate() after updating the blocks.
+ *
+ * Blocks before the optimally-planned block can't have their junction speeds
+ * changed by the planner passes, so the scan starts from the planned block as
+ * it was before the passes ran, rather than from the tail.
  */
-void Planner::recalculate_trapezoids() {
+void Planner::recalculate_trapezoids(const uint8_t start_block_index) {
   // The tail may be changed by the ISR so get a local copy.
-  uint8_t block_index = block_buffer_tail,
+  const uint8_t tail_block_index = block_buffer_tail;
+  uint8_t block_index = start_block_index,
           head_block_index = block_buffer_head;
+
+  // If the ISR has already consumed the start block, begin from the tail
+  if (BLOCK_MOD(head_block_index - block_index) > BLOCK_MOD(head_block_index - tail_block_index))
+    block_index = tail_block_index;
+
   // Since there could be a sync block in the head of the queue, and the
   // next loop must not recalculate the head block (as it needs to be
   // specially handled), scan backwards to the first non-SYNC block.
@@ -1153,7 +1254,7 @@ void Planner::recalculate_trapezoids() {
     head_block_index = prev_index;
   }
 
-  // Go from the tail (currently executed block) to the first block, without including it)
+  // Go from the start block to the last block, without including it
   block_t *block = nullptr, *next = nullptr;
   float current_entry_speed = 0.0, next_entry_speed = 0.0;
   while (block_index != head_block_index) {
@@ -1238,14 +1339,18 @@ void Planner::recalculate_trapezoids() {
 }
 
 void Planner::recalculate() {
+  HAL_BENCH(RECALCULATE);
+
+  // Blocks before the planned block are final. Remember where that was.
+  const uint8_t planned_block_index = block_buffer_planned;
   // Initialize block index to the last block in the planner buffer.
   const uint8_t block_index = prev_block_index(block_buffer_head);
   // If there is just one block, no planning can be done. Avoid it!
-  if (block_index != block_buffer_planned) {
+  if (block_index != planned_block_index) {
     reverse_pass();
     forward_pass();
   }
-  recalculate_trapezoids();
+  recalculate_trapezoids(planned_block_index);
 }
 
 #if ENABLED(AUTOTEMP)
@@ -1592,6 +1697,9 @@ void Planner::quick_stop() {
   // Make sure to drop any attempt of queuing moves for 1 second
   cleaning_buffer_counter = TEMP_TIMER_FREQUENCY;
 
+  // Drop the rest of a streaming arc
+  TERN_(ARC_STREAMING, arc_pending = false);
+
   // Reenable Stepper ISR
   if (was_enabled) stepper.wake_up();
 
@@ -1760,6 +1868,7 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
   #endif
   , feedRate_t fr_mm_s, const uint8_t extruder, const float &millimeters/*=0.0*/
 ) {
+  HAL_BENCH(POPULATE);
 
   const int32_t da = target.a - position.a,
                 db = target.b - position.b,
@@ -2394,10 +2503,14 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
         xyze_float_t junction_unit_vec = unit_vec - prev_unit_vec;
         normalize_junction_vector(junction_unit_vec);
 
-        const float junction_acceleration = limit_value_by_axis_maximum(block->acceleration, junction_unit_vec),
-                    sin_theta_d2 = SQRT(0.5f * (1.0f - junction_cos_theta)); // Trig half angle identity. Always positive.
+        const float junction_acceleration = limit_value_by_axis_maximum(block->acceleration, junction_unit_vec);
 
-        vmax_junction_sqr = junction_acceleration * junction_deviation_mm * sin_theta_d2 / (1.0f - sin_theta_d2);
+        #if ENABLED(JD_USE_FACTOR_TABLE)
+          vmax_junction_sqr = junction_acceleration * junction_deviation_mm * 2 * junction_factor(junction_cos_theta) / (1.0f + junction_cos_theta);
+        #else
+          const float sin_theta_d2 = SQRT(0.5f * (1.0f - junction_cos_theta)); // Trig half angle identity. Always positive.
+          vmax_junction_sqr = junction_acceleration * junction_deviation_mm * sin_theta_d2 / (1.0f - sin_theta_d2);
+        #endif
 
         #if ENABLED(JD_HANDLE_SMALL_SEGMENTS)
 
@@ -151,6 +151,27 @@ typedef struct block_t {
 
   volatile uint8_t flag;                    // Block flags (See BlockFlag enum above) - Modified by ISR and main thread!
 
+  // Byte-sized fields are grouped here to keep the block free of padding
+  uint8_t direction_bits;                   // The direction bit set for this block (refers to *_DIRECTION_BIT in config.h)
+
+  #if HAS_MULTI_EXTRUDER
+    uint8_t extruder;                       // The extruder to move (if E move)
+  #else
+    static constexpr uint8_t extruder = 0;
+  #endif
+
+  #if ENABLED(LIN_ADVANCE)
+    bool use_advance_lead;
+  #endif
+
+  #if HAS_FAN
+    uint8_t fan_speed[FAN_COUNT];
+  #endif
+
+  #if ENABLED(BARICUDA)
+    uint8_t valve_pressure, e_to_p_pressure;
+  #endif
+
   // Fields used by the motion planner to manage acceleration
   float nominal_speed_sqr,                  // The nominal speed for this block in (mm/sec)^2
         entry_speed_sqr,                    // Entry speed at previous-current junction in (mm/sec)^2
@@ -164,12 +185,6 @@ typedef struct block_t {
   };
   uint32_t step_event_count;                // The number of step events required to complete this block
 
-  #if HAS_MULTI_EXTRUDER
-    uint8_t extruder;                       // The extruder to move (if E move)
-  #else
-    static constexpr uint8_t extruder = 0;
-  #endif
-
   TERN_(MIXING_EXTRUDER, MIXER_BLOCK_FIELD); // Normalized color for the mixing steppers
 
   // Settings for the trapezoid generator
@@ -186,11 +201,8 @@ typedef struct block_t {
     uint32_t acceleration_rate;             // The acceleration rate used for acceleration calculation
   #endif
 
-  uint8_t direction_bits;                   // The direction bit set for this block (refers to *_DIRECTION_BIT in config.h)
-
   // Advance extrusion
   #if ENABLED(LIN_ADVANCE)
-    bool use_advance_lead;
     uint16_t advance_speed,                 // STEP timer value for extruder speed offset ISR
              max_adv_steps,                 // max. advance steps to get cruising speed pressure (not always nominal_speed!)
              final_adv_steps;               // advance steps due to exit speed
@@ -210,14 +222,6 @@ typedef struct block_t {
     cutter_power_t cutter_power;            // Power level for Spindle, Laser, etc.
   #endif
 
-  #if HAS_FAN
-    uint8_t fan_speed[FAN_COUNT];
-  #endif
-
-  #if ENABLED(BARICUDA)
-    uint8_t valve_pressure, e_to_p_pressure;
-  #endif
-
   #if HAS_WIRED_LCD
     uint32_t segment_time_us;
   #endif
@@ -311,6 +315,10 @@ class Planner {
     static uint16_t cleaning_buffer_counter;        // A counter to disable queuing of blocks
     static uint8_t delay_before_delivering;         // This counter delays delivery of blocks when queue becomes empty to allow the opportunity of merging blocks
 
+    #if ENABLED(ARC_STREAMING)
+      static bool arc_pending;                      // An arc is still being fed to the planner. Cleared by quick_stop.
+    #endif
+
 
     #if ENABLED(DISTINCT_E_FACTORS)
       static uint8_t last_extruder;                 // Respond to extruder change
@@ -646,7 +654,10 @@ class Planner {
     FORCE_INLINE static block_t* get_next_free_block(uint8_t &next_buffer_head, const uint8_t count=1) {
 
       // Wait until there are enough slots free
-      while (moves_free() < count) { idle(); }
+      if (moves_free() < count) {
+        HAL_BENCH(WAIT);
+        while (moves_free() < count) idle();
+      }
 
       // Return the first available block
       next_buffer_head = next_block_index(block_buffer_head);
@@ -871,6 +882,16 @@ class Planner {
         block_buffer_tail = next_block_index(block_buffer_tail);
     }
 
+    /**
+     * Get the acceleration and plateau step counts for a trapezoid, with float
+     * or integer math. Return true if the nominal rate is reached (has a plateau).
+     * Used by calculate_trapezoid_for_block() and by the D-code benchmark.
+     */
+    static bool trapezoid_steps_float(uint32_t &accelerate_steps, uint32_t &plateau_steps,
+      const uint32_t initial_rate, const uint32_t final_rate, const uint32_t nominal_rate, const uint32_t accel, const uint32_t step_event_count);
+    static bool trapezoid_steps_fixed(uint32_t &accelerate_steps, uint32_t &plateau_steps,
+      const uint32_t initial_rate, const uint32_t final_rate, const uint32_t nominal_rate, const uint32_t accel, const uint32_t step_event_count);
+
     #if HAS_WIRED_LCD
       static uint16_t block_buffer_runtime();
       static void clear_block_buffer_runtime();
@@ -922,6 +943,55 @@ class Planner {
       return (accel * 2 * distance - sq(initial_rate) + sq(final_rate)) / (accel * 4);
     }
 
+    /**
+     * Integer counterparts of the above, for PLANNER_FIXED_POINT_TRAPEZOID.
+     * The squared rates need 64 bits, but most quotients fit in 32 bits
+     * and can use the hardware divider instead of the 64-bit library call.
+     */
+    static FORCE_INLINE uint32_t udiv_ceil(const uint64_t n, const uint32_t d) {
+      if (n >> 32) return (n + d - 1) / d;
+      const uint32_t q = uint32_t(n) / d;
+      return q + (q * d != uint32_t(n));
+    }
+    static FORCE_INLINE uint32_t udiv_floor(const uint64_t n, const uint32_t d) {
+      return (n >> 32) ? uint32_t(n / d) : uint32_t(n) / d;
+    }
+
+    // Steps to accelerate from low_rate to high_rate (0 if high_rate <= low_rate), rounded up or down
+    static uint32_t acceleration_steps_ceil(const uint32_t low_rate, const uint32_t high_rate, const uint32_t accel) {
+      if (!accel || high_rate <= low_rate) return 0;
+      return udiv_ceil(uint64_t(high_rate - low_rate) * (high_rate + low_rate), accel * 2);
+    }
+    static uint32_t acceleration_steps_floor(const uint32_t low_rate, const uint32_t high_rate, const uint32_t accel) {
+      if (!accel || high_rate <= low_rate) return 0;
+      return udiv_floor(uint64_t(high_rate - low_rate) * (high_rate + low_rate), accel * 2);
+    }
+
+    // Braking point for a block with no plateau, rounded up (0 if it falls before the start)
+    static uint32_t intersection_steps_ceil(const uint32_t initial_rate, const uint32_t final_rate, const uint32_t accel, const uint32_t distance) {
+      if (!accel) return 0;
+      const int64_t n = int64_t(accel) * 2 * distance - sq(int64_t(initial_rate)) + sq(int64_t(final_rate));
+      return n > 0 ? udiv_ceil(n, accel * 4) : 0;
+    }
+
+    #if ENABLED(S_CURVE_ACCELERATION)
+      // Integer counterpart of final_speed() for rates, rounded down
+      static uint32_t final_rate_fixed(const uint32_t initial_rate, const uint32_t accel, const uint32_t steps) {
+        const uint64_t n = sq(uint64_t(initial_rate)) + uint64_t(accel) * 2 * steps;
+        // Digit-by-digit square root, in 32 bits for all but the highest rates
+        if (n >> 32) {
+          uint64_t v = n, r = 0, b = 1ULL << 62;
+          while (b > v) b >>= 2;
+          for (; b; b >>= 2) if (v >= r + b) { v -= r + b; r = (r >> 1) + b; } else r >>= 1;
+          return uint32_t(r);
+        }
+        uint32_t v = uint32_t(n), r = 0, b = 1UL << 30;
+        while (b > v) b >>= 2;
+        for (; b; b >>= 2) if (v >= r + b) { v -= r + b; r = (r >> 1) + b; } else r >>= 1;
+        return r;
+      }
+    #endif
+
     /**
      * Calculate the maximum allowable speed squared at this point, in order
      * to reach 'target_velocity_sqr' using 'acceleration' within a given
@@ -948,7 +1018,7 @@ class Planner {
     static void reverse_pass();
     static void forward_pass();
 
-    static void recalculate_trapezoids();
+    static void recalculate_trapezoids(const uint8_t start_block_index);
 
     static void recalculate();
 
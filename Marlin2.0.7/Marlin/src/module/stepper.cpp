@@ -132,6 +132,10 @@ Stepper stepper; // Singleton
   #include "../feature/spindle_laser.h"
 #endif
 
+#if ENABLED(STEPPER_ISR_PROFILING)
+  #include "../feature/stepper_profiler.h"
+#endif
+
 // public:
 
 #if EITHER(HAS_EXTRA_ENDSTOPS, Z_STEPPER_AUTO_ALIGN)
@@ -180,6 +184,12 @@ bool Stepper::abort_current_block;
 uint32_t Stepper::acceleration_time, Stepper::deceleration_time;
 uint8_t Stepper::steps_per_isr;
 
+#if ENABLED(STEP_PULSE_DMA)
+  static struct { uint8_t port; uint32_t on, off; } step_dma_axis[XYZE]; // DMA port and BSRR words (active, idle) per step pin
+  static bool step_dma_ready;         // True if every step pin got a DMA port
+  static uint32_t step_dma_interval;  // Ticks from the last block phase to the next one
+#endif
+
 TERN(ADAPTIVE_STEP_SMOOTHING,,constexpr) uint8_t Stepper::oversampling_factor;
 
 xyze_long_t Stepper::delta_error{0};
@@ -1264,9 +1274,10 @@ void Stepper::set_directions() {
     }
 
     FORCE_INLINE int32_t Stepper::_eval_bezier_curve(const uint32_t curr_step) {
-      #if defined(__arm__) || defined(__thumb__)
+      #if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__)
 
-        // For ARM Cortex M3/M4 CPUs, we have the optimized assembler version, that takes 43 cycles to execute
+        // For ARMv7-M (Cortex M3/M4/M7) CPUs, we have the optimized assembler version, that takes 43 cycles to execute.
+        // UMULL and SMLAL aren't available on ARMv6-M (Cortex M0/M0+), which gets the C version below.
         uint32_t flo = 0;
         uint32_t fhi = bezier_AV * curr_step;
         uint32_t t = fhi;
@@ -1306,7 +1317,7 @@ void Stepper::set_directions() {
 
       #else
 
-        // For non ARM targets, we provide a fallback implementation. Really doubt it
+        // For non ARMv7-M targets, we provide a fallback implementation. Really doubt it
         // will be useful, unless the processor is fast and 32bit
 
         uint32_t t = bezier_AV * curr_step;               // t: Range 0 - 1^32 = 32 bits
@@ -1329,6 +1340,15 @@ void Stepper::set_directions() {
       #endif
     }
   #endif
+
+  #if ENABLED(MARLIN_DEV_MODE)
+    // Evaluate one point of a Bézier speed curve, for D111. Motion must be idle.
+    int32_t Stepper::eval_bezier_curve(const int32_t v0, const int32_t v1, const uint32_t av, const uint32_t curr_step) {
+      _calc_bezier_curve_coeffs(v0, v1, av);
+      return _eval_bezier_curve(curr_step);
+    }
+  #endif
+
 #endif // S_CURVE_ACCELERATION
 
 /**
@@ -1358,6 +1378,8 @@ void Stepper::isr() {
 
   static uint32_t nextMainISR = 0;  // Interval until the next main Stepper Pulse phase (0 = Now)
 
+  TERN_(STEPPER_ISR_PROFILING, const uint32_t isr_start = StepperProfiler::cycles());
+
   #ifndef __AVR__
     // Disable interrupts, to avoid ISR preemption while we reprogram the period
     // (AVR enters the ISR with global interrupts disabled, so no need to do it here)
@@ -1381,10 +1403,23 @@ void Stepper::isr() {
     // Enable ISRs to reduce USART processing latency
     ENABLE_ISRS();
 
-    if (!nextMainISR) pulse_phase_isr();                            // 0 = Do coordinated axes Stepper pulses
+    #if ENABLED(STEP_PULSE_DMA)
+      // A late burst is still running. Come back when it's done instead of spinning on it.
+      if (!nextMainISR && step_dma_ready) nextMainISR = HAL_step_dma_remaining();
+    #endif
+
+    #if ENABLED(STEPPER_ISR_PROFILING)
+      if (!nextMainISR) ISR_PROFILE(ISR_PHASE_PULSE, pulse_phase_isr());
+    #else
+      if (!nextMainISR) pulse_phase_isr();                          // 0 = Do coordinated axes Stepper pulses
+    #endif
 
     #if ENABLED(LIN_ADVANCE)
-      if (!nextAdvanceISR) nextAdvanceISR = advance_isr();          // 0 = Do Linear Advance E Stepper pulses
+      #if ENABLED(STEPPER_ISR_PROFILING)
+        if (!nextAdvanceISR) ISR_PROFILE(ISR_PHASE_ADVANCE, nextAdvanceISR = advance_isr());
+      #else
+        if (!nextAdvanceISR) nextAdvanceISR = advance_isr();        // 0 = Do Linear Advance E Stepper pulses
+      #endif
     #endif
 
     #if ENABLED(INTEGRATED_BABYSTEPPING)
@@ -1394,7 +1429,11 @@ void Stepper::isr() {
 
     // ^== Time critical. NOTHING besides pulse generation should be above here!!!
 
-    if (!nextMainISR) nextMainISR = block_phase_isr();  // Manage acc/deceleration, get next block
+    #if ENABLED(STEPPER_ISR_PROFILING)
+      if (!nextMainISR) ISR_PROFILE(ISR_PHASE_BLOCK, nextMainISR = block_phase_isr());
+    #else
+      if (!nextMainISR) nextMainISR = block_phase_isr();  // Manage acc/deceleration, get next block
+    #endif
 
     #if ENABLED(INTEGRATED_BABYSTEPPING)
       if (is_babystep)                                  // Avoid ANY stepping too soon after baby-stepping
@@ -1490,7 +1529,10 @@ void Stepper::isr() {
      * loop to 10 iterations. Beyond that, there's no way to ensure correct pulse
      * timing, since the MCU isn't fast enough.
      */
-    if (!--max_loops) next_isr_ticks = min_ticks;
+    if (!--max_loops) {
+      next_isr_ticks = min_ticks;
+      TERN_(STEPPER_ISR_PROFILING, StepperProfiler::loops_exhausted++);
+    }
 
     // Advance pulses if not enough time to wait for the next ISR
   } while (next_isr_ticks < min_ticks);
@@ -1501,6 +1543,8 @@ void Stepper::isr() {
   // Set the next ISR to fire at the proper time
   HAL_timer_set_compare(STEP_TIMER_NUM, hal_timer_t(next_isr_ticks));
 
+  TERN_(STEPPER_ISR_PROFILING, StepperProfiler::record_isr(isr_start));
+
   // Don't forget to finally reenable interrupts
   ENABLE_ISRS();
 }
@@ -1537,6 +1581,19 @@ void Stepper::pulse_phase_isr() {
   // Just update the value we will get at the end of the loop
   step_events_completed += events_to_do;
 
+  #if ENABLED(STEP_PULSE_DMA)
+    // Hand multi-step batches to DMA, except for the last one in the block. Those
+    // pulses must be done before the next block can change the directions.
+    if (step_dma_ready && WITHIN(events_to_do, 2, STEP_PULSE_DMA_EVENTS) && events_to_do < pending_events) {
+      // Spread the events over 7/8 of the time to the next block phase, so they end
+      // before that ISR even if the rate is going up. Pulses that don't fit at their
+      // minimum widths are left to the loop below.
+      const uint32_t half_period = step_dma_interval * 7 / (16 * events_to_do);
+      if (half_period >= _MAX(PULSE_HIGH_TICK_COUNT, PULSE_LOW_TICK_COUNT, hal_timer_t(2)))
+        return pulse_phase_dma(events_to_do, hal_timer_t(_MIN(half_period, uint32_t(HAL_TIMER_TYPE_MAX))));
+    }
+  #endif
+
   // Take multiple steps per interrupt (For high speed moves)
   #if ISR_MULTI_STEPS
     bool firstStep = true;
@@ -2247,10 +2304,66 @@ uint32_t Stepper::block_phase_isr() {
     #endif
   }
 
+  TERN_(STEP_PULSE_DMA, step_dma_interval = interval);
+
   // Return the interval to wait
   return interval;
 }
 
+#if ENABLED(STEP_PULSE_DMA)
+
+  /**
+   * Run the Bresenham for a batch of step events and hand the resulting pulses
+   * to DMA, one high or low level every half_period ticks.
+   */
+  void Stepper::pulse_phase_dma(const uint8_t events, const hal_timer_t half_period) {
+
+    #define DMA_PULSE_PREP(AXIS) do{ \
+      delta_error[_AXIS(AXIS)] += advance_dividend[_AXIS(AXIS)]; \
+      if (delta_error[_AXIS(AXIS)] >= 0) { \
+        count_position[_AXIS(AXIS)] += count_direction[_AXIS(AXIS)]; \
+        delta_error[_AXIS(AXIS)] -= advance_divisor; \
+        on[step_dma_axis[_AXIS(AXIS)].port] |= step_dma_axis[_AXIS(AXIS)].on; \
+        off[step_dma_axis[_AXIS(AXIS)].port] |= step_dma_axis[_AXIS(AXIS)].off; \
+      } \
+    }while(0)
+
+    uint32_t *word[STEP_DMA_PORTS];
+    LOOP_L_N(p, STEP_DMA_PORTS) word[p] = step_dma_buffer[p];
+
+    LOOP_L_N(n, events) {
+      uint32_t on[STEP_DMA_PORTS] = { 0 }, off[STEP_DMA_PORTS] = { 0 };
+
+      #if HAS_X_STEP
+        DMA_PULSE_PREP(X);
+      #endif
+      #if HAS_Y_STEP
+        DMA_PULSE_PREP(Y);
+      #endif
+      #if HAS_Z_STEP
+        DMA_PULSE_PREP(Z);
+      #endif
+
+      #if ENABLED(LIN_ADVANCE)
+        delta_error.e += advance_dividend.e;
+        if (delta_error.e >= 0) {
+          count_position.e += count_direction.e;
+          delta_error.e -= advance_divisor;
+          // Don't step E here - But remember the number of steps to perform
+          motor_direction(E_AXIS) ? --LA_steps : ++LA_steps;
+        }
+      #elif HAS_E0_STEP
+        DMA_PULSE_PREP(E);
+      #endif
+
+      LOOP_L_N(p, STEP_DMA_PORTS) { *word[p]++ = on[p]; *word[p]++ = off[p]; }
+    }
+
+    HAL_step_dma_start(events, half_period);
+  }
+
+#endif // STEP_PULSE_DMA
+
 #if ENABLED(LIN_ADVANCE)
 
   // Timer interrupt for E. LA_steps is set in the main routine
@@ -2398,6 +2511,8 @@ void Stepper::init() {
   // Init Microstepping Pins
   TERN_(HAS_MICROSTEPS, microstep_init());
 
+  TERN_(STEPPER_ISR_PROFILING, stepper_profiler.init());
+
   // Init Dir Pins
   TERN_(HAS_X_DIR, X_DIR_INIT());
   TERN_(HAS_X2_DIR, X2_DIR_INIT());
@@ -2579,6 +2694,30 @@ void Stepper::init() {
     E_AXIS_INIT(7);
   #endif
 
+  #if ENABLED(STEP_PULSE_DMA)
+    // Give each step pin's GPIO port a DMA stream. Bursts are off if there are too many ports.
+    step_dma_ready = true;
+    #define STEP_DMA_INIT(AXIS, PIN, INV) do{ \
+      const uint8_t port = HAL_step_dma_port(PIN); \
+      const uint32_t bit = HAL_step_dma_bit(PIN); \
+      if (port == STEP_DMA_NO_PORT) step_dma_ready = false; \
+      else step_dma_axis[AXIS] = { port, (INV) ? bit << 16 : bit, (INV) ? bit : bit << 16 }; \
+    }while(0)
+    #if HAS_X_STEP
+      STEP_DMA_INIT(X_AXIS, X_STEP_PIN, INVERT_X_STEP_PIN);
+    #endif
+    #if HAS_Y_STEP
+      STEP_DMA_INIT(Y_AXIS, Y_STEP_PIN, INVERT_Y_STEP_PIN);
+    #endif
+    #if HAS_Z_STEP
+      STEP_DMA_INIT(Z_AXIS, Z_STEP_PIN, INVERT_Z_STEP_PIN);
+    #endif
+    #if DISABLED(LIN_ADVANCE) && HAS_E0_STEP
+      STEP_DMA_INIT(E_AXIS, E0_STEP_PIN, INVERT_E_STEP_PIN);
+    #endif
+    if (step_dma_ready) HAL_step_dma_init();
+  #endif
+
   #if DISABLED(I2S_STEPPER_STREAM)
     HAL_timer_start(STEP_TIMER_NUM, 122); // Init Stepper ISR to 122 Hz for quick starting
     wake_up();
@@ -2841,6 +2980,8 @@ void Stepper::report_positions() {
       cli();
     #endif
 
+    TERN_(STEP_PULSE_DMA, HAL_step_dma_wait()); // Don't change directions under a running burst
+
     switch (axis) {
 
       #if ENABLED(BABYSTEP_XY)
@@ -192,7 +192,12 @@
 #endif
 
 // But the user could be enforcing a minimum time, so the loop time is
-#define ISR_LOOP_CYCLES (ISR_LOOP_BASE_CYCLES + _MAX(MIN_STEPPER_PULSE_CYCLES, MIN_ISR_LOOP_CYCLES))
+#if ENABLED(STEP_PULSE_DMA)
+  // ...unless the pulses are timed by DMA, and the loop only has to prepare them
+  #define ISR_LOOP_CYCLES (ISR_LOOP_BASE_CYCLES + MIN_ISR_LOOP_CYCLES)
+#else
+  #define ISR_LOOP_CYCLES (ISR_LOOP_BASE_CYCLES + _MAX(MIN_STEPPER_PULSE_CYCLES, MIN_ISR_LOOP_CYCLES))
+#endif
 
 // If linear advance is enabled, then it is handled separately
 #if ENABLED(LIN_ADVANCE)
@@ -405,6 +410,16 @@ class Stepper {
     // The stepper block processing ISR phase
     static uint32_t block_phase_isr();
 
+    #if ENABLED(STEP_PULSE_DMA)
+      // Prepare a batch of step events and hand it to DMA
+      static void pulse_phase_dma(const uint8_t events, const hal_timer_t half_period);
+    #endif
+
+    #if BOTH(S_CURVE_ACCELERATION, MARLIN_DEV_MODE)
+      // Evaluate one point of a Bézier speed curve, for D111. Motion must be idle.
+      static int32_t eval_bezier_curve(const int32_t v0, const int32_t v1, const uint32_t av, const uint32_t curr_step);
+    #endif
+
     #if ENABLED(LIN_ADVANCE)
       // The Linear advance ISR phase
       static uint32_t advance_isr();
@@ -3299,8 +3299,10 @@ millis_t Temperature::next_temp_report_ms;
 void Temperature::auto_report_temperatures()
 {
     if(auto_report_temp_interval && ELAPSED(millis(), next_temp_report_ms)) {
-        next_temp_report_ms = millis() + 1000UL * auto_report_temp_interval;
         PORT_REDIRECT(SERIAL_BOTH);
+        // No room for the whole report? Try again next loop, with fresher values.
+        if(!serial_tx_room(48 + 24 * (HOTENDS))) return;
+        next_temp_report_ms = millis() + 1000UL * auto_report_temp_interval;
         print_heater_states(active_extruder);
         SERIAL_EOL();
     }
@@ -127,6 +127,12 @@ char CardReader::proc_filenames[SD_PROCEDURE_DEPTH][MAXPATHNAMELENGTH];
 
 uint32_t CardReader::filesize, CardReader::sdpos;
 
+#if ENABLED(SD_BULK_READ)
+  alignas(4) char CardReader::bulk_buffer[SD_BULK_READ_SIZE];
+  uint32_t CardReader::bulk_pos;
+  uint16_t CardReader::bulk_ind, CardReader::bulk_len;
+#endif
+
 CardReader::CardReader() {
   #if ENABLED(SDCARD_SORT_ALPHA)
     sort_count = 0;
@@ -492,6 +498,7 @@ void CardReader::endFilePrint(TERN_(SD_RESORT, const bool re_sort/*=false*/)) {
   TERN_(ADVANCED_PAUSE_FEATURE, did_pause_print = 0);
   TERN_(DWIN_CREALITY_LCD, HMI_flag.print_finish = flag.sdprinting);
   flag.sdprinting = flag.abort_sd_printing = false;
+  TERN_(SD_BULK_READ, bulk_reset());
   if (isFileOpen()) file.close();
   TERN_(SD_RESORT, if (re_sort) presort());
 }
@@ -597,6 +604,7 @@ void CardReader::openFileRead(char * const path, const uint8_t subcall_type/*=0*
   if (file.open(diveDir, fname, O_READ)) {
     filesize = file.fileSize();
     sdpos = 0;
+    TERN_(SD_BULK_READ, bulk_reset());
 
     PORT_REDIRECT(SERIAL_BOTH);
     SERIAL_ECHOLNPAIR(STR_SD_FILE_OPENED, fname, STR_SD_SIZE, filesize);
@@ -756,6 +764,7 @@ void CardReader::closefile(const bool store_location/*=false*/) {
   file.close();
   flag.saving = flag.logging = false;
   sdpos = 0;
+  TERN_(SD_BULK_READ, bulk_reset());
   TERN_(EMERGENCY_PARSER, emergency_parser.enable());
 
   if (store_location) {
@@ -764,6 +773,46 @@ void CardReader::closefile(const bool store_location/*=false*/) {
   }
 }
 
+#if ENABLED(SD_BULK_READ)
+
+  /**
+   * Get the next run of bytes of the open file, up to but not including
+   * an end-of-line, straight out of the bulk buffer. The buffer is refilled
+   * a block-aligned chunk at a time, so a full chunk is read from the card
+   * without a copy through the volume cache.
+   *
+   * Set 'eol' when the run ends with an end-of-line, which is consumed.
+   * A run that stops short of an end-of-line hit the end of the buffer
+   * (or the file) and the line continues in the next run.
+   *
+   * As with get(), sdpos is left at the last byte consumed and goes to
+   * filesize once the end of the file is read. Return nullptr on error.
+   */
+  const char* CardReader::get_span(uint16_t &len, bool &eol) {
+    len = 0; eol = false;
+    if (bulk_ind >= bulk_len) {
+      bulk_pos = file.curPosition();
+      const int16_t n = file.read(bulk_buffer, SD_BULK_READ_SIZE - (bulk_pos & (SD_BULK_READ_SIZE - 1)));
+      if (n < 0) { bulk_reset(); return nullptr; }
+      bulk_ind = 0; bulk_len = n;
+      if (!n) { sdpos = bulk_pos; return bulk_buffer; } // End of file
+    }
+
+    const char * const start = bulk_buffer + bulk_ind;
+    const uint16_t avail = bulk_len - bulk_ind;
+    const char *end = (const char*)memchr(start, '\n', avail);
+    const char * const cr = (const char*)memchr(start, '\r', end ? end - start : avail);
+    if (cr) end = cr;
+
+    eol = end != nullptr;
+    len = eol ? end - start : avail;
+    bulk_ind += len + eol;
+    sdpos = bulk_pos + bulk_ind - 1;
+    return start;
+  }
+
+#endif // SD_BULK_READ
+
 //
 // Get info for a file in the working directory by index
 //
@@ -1175,6 +1224,7 @@ uint16_t CardReader::get_num_Files() {
 //
 void CardReader::fileHasFinished() {
   planner.synchronize();
+  TERN_(SD_BULK_READ, bulk_reset());
   file.close();
   if (file_subcall_ctr > 0) { // Resume calling file after closing procedure
     file_subcall_ctr--;
@@ -1200,8 +1250,9 @@ void CardReader::fileHasFinished() {
   void CardReader::auto_report_sd_status() {
     millis_t current_ms = millis();
     if (auto_report_sd_interval && ELAPSED(current_ms, next_sd_report_ms)) {
-      next_sd_report_ms = current_ms + 1000UL * auto_report_sd_interval;
       PORT_REDIRECT(auto_report_port);
+      if (!serial_tx_room(40)) return; // Report on a later loop
+      next_sd_report_ms = current_ms + 1000UL * auto_report_sd_interval;
       report_status();
     }
   }
@@ -159,11 +159,15 @@ public:
   static inline uint32_t getIndex() { return sdpos; }
   static inline uint32_t getFileSize() { return filesize; }
   static inline bool eof() { return sdpos >= filesize; }
-  static inline void setIndex(const uint32_t index) { sdpos = index; file.seekSet(index); }
+  static inline void setIndex(const uint32_t index) { TERN_(SD_BULK_READ, bulk_reset()); sdpos = index; file.seekSet(index); }
   static inline char* getWorkDirName() { workDir.getDosName(filename); return filename; }
-  static inline int16_t get() { sdpos = file.curPosition(); return (int16_t)file.read(); }
-  static inline int16_t read(void* buf, uint16_t nbyte) { return file.isOpen() ? file.read(buf, nbyte) : -1; }
-  static inline int16_t write(void* buf, uint16_t nbyte) { return file.isOpen() ? file.write(buf, nbyte) : -1; }
+  static inline int16_t get() { TERN_(SD_BULK_READ, bulk_release()); sdpos = file.curPosition(); return (int16_t)file.read(); }
+  static inline int16_t read(void* buf, uint16_t nbyte) { TERN_(SD_BULK_READ, bulk_release()); return file.isOpen() ? file.read(buf, nbyte) : -1; }
+  static inline int16_t write(void* buf, uint16_t nbyte) { TERN_(SD_BULK_READ, bulk_release()); return file.isOpen() ? file.write(buf, nbyte) : -1; }
+
+  #if ENABLED(SD_BULK_READ)
+    static const char* get_span(uint16_t &len, bool &eol);
+  #endif
 
   static Sd2Card& getSd2Card() { return sd2card; }
 
@@ -246,6 +250,21 @@ private:
 
   static uint32_t filesize, sdpos;
 
+  //
+  // Bulk read of the file being printed
+  //
+  #if ENABLED(SD_BULK_READ)
+    alignas(4) static char bulk_buffer[SD_BULK_READ_SIZE]; // Word-aligned for SDIO DMA block reads
+    static uint32_t bulk_pos;         // File position of bulk_buffer[0]
+    static uint16_t bulk_ind, bulk_len;
+    static inline void bulk_reset() { bulk_ind = bulk_len = 0; }
+    // Put the file position back at the next unread byte for a direct read
+    static inline void bulk_release() {
+      if (bulk_ind < bulk_len) file.seekSet(bulk_pos + bulk_ind);
+      bulk_reset();
+    }
+  #endif
+
   //
   // Procedure calls to other files
   //
@@ -0,0 +1,117 @@
+#!/usr/bin/env python
+
+""" Generate the G-code corpora used by buildroot/bin/planner_bench.
+
+Each corpus stresses a different part of the G-code -> planner pipeline:
+
+  vase    Spiral vase: one continuous extrusion with a slowly rising Z
+  arcs    G2/G3 arcs of many radii, segmented by plan_arc()
+  small   Dense curves of 0.1-0.3mm segments, as sliced from high-res meshes
+  travel  Short extrusions separated by retracts and long G0 travels
+
+The output is deterministic for a given seed so runs can be compared.
+"""
+
+from __future__ import print_function
+from __future__ import division
+
+import argparse
+import math
+import os
+import random
+
+parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+parser.add_argument('-o', '--output', default='.', help='Output directory (default=.)')
+parser.add_argument('-s', '--seed', type=int, default=1, help='Random seed (default=1)')
+parser.add_argument('-n', '--scale', type=float, default=1.0, help='Length multiplier for every corpus (default=1)')
+args = parser.parse_args()
+
+CX, CY = 100.0, 100.0   # Bed center
+E_PER_MM = 0.033        # 0.4mm line, 0.2mm layer, 1.75mm filament
+
+def header(out, name):
+    out.write('; Planner benchmark corpus: %s\n' % name)
+    out.write('M302 P1\n')              # Allow cold extrusion, the simulated hotend is not heated
+    out.write('G21\nG90\nM82\n')
+    out.write('G92 X%.1f Y%.1f Z0.2 E0\n' % (CX, CY))
+    out.write('M400\n')
+
+def footer(out):
+    out.write('M400\n')
+
+class Path:
+    """ Absolute-mode path writer that tracks position and extrusion """
+    def __init__(self, out):
+        self.out, self.x, self.y, self.e = out, CX, CY, 0.0
+
+    def line(self, x, y, z=None, f=None, extrude=True):
+        d = math.hypot(x - self.x, y - self.y)
+        words = ['G1' if extrude else 'G0', 'X%.3f' % x, 'Y%.3f' % y]
+        if z is not None: words.append('Z%.3f' % z)
+        if extrude:
+            self.e += d * E_PER_MM
+            words.append('E%.5f' % self.e)
+        if f: words.append('F%d' % f)
+        self.out.write(' '.join(words) + '\n')
+        self.x, self.y = x, y
+
+    def retract(self, mm, f=2400):
+        self.e -= mm
+        self.out.write('G1 E%.5f F%d\n' % (self.e, f))
+
+def vase(out, rnd):
+    p = Path(out)
+    seg_per_rev, layers = 120, int(30 * args.scale)
+    p.line(CX + 40, CY, f=6000, extrude=False)
+    for i in range(seg_per_rev * layers):
+        a = 2 * math.pi * i / seg_per_rev
+        r = 40 + 5 * math.sin(6 * a) + 0.02 * i / seg_per_rev   # Lobed, slightly flaring wall
+        p.line(CX + r * math.cos(a), CY + r * math.sin(a), 0.2 + 0.2 * i / seg_per_rev, f=3000 if i == 0 else None)
+
+def arcs(out, rnd):
+    p = Path(out)
+    p.line(CX, CY, f=6000, extrude=False)
+    for _ in range(int(150 * args.scale)):
+        r = rnd.uniform(0.5, 40)
+        a0, sweep = rnd.uniform(0, 2 * math.pi), rnd.uniform(0.2, 2 * math.pi)
+        cw = rnd.random() < 0.5
+        a1 = a0 - sweep if cw else a0 + sweep
+        # Start on the circle around a random center, then arc
+        cx, cy = rnd.uniform(60, 140), rnd.uniform(60, 140)
+        p.line(cx + r * math.cos(a0), cy + r * math.sin(a0), f=9000, extrude=False)
+        x, y = cx + r * math.cos(a1), cy + r * math.sin(a1)
+        p.e += r * sweep * E_PER_MM
+        out.write('%s X%.3f Y%.3f I%.3f J%.3f E%.5f F%d\n' % ('G2' if cw else 'G3', x, y, cx - p.x, cy - p.y, p.e, rnd.choice((1800, 3000, 4800))))
+        p.x, p.y = x, y
+
+def small(out, rnd):
+    p = Path(out)
+    p.line(CX - 50, CY, f=6000, extrude=False)
+    x, y, a, k = CX - 50, CY, 0.0, 0.0
+    for i in range(int(20000 * args.scale)):
+        k += rnd.uniform(-0.02, 0.02)           # Slowly wandering curvature
+        k = max(-0.5, min(0.5, k))
+        step = rnd.uniform(0.1, 0.3)
+        a += k * step * 5
+        x, y = x + step * math.cos(a), y + step * math.sin(a)
+        if not (20 < x < 180 and 20 < y < 180):  # Turn back toward the middle
+            a = math.atan2(CY - y, CX - x)
+            x, y = max(20, min(180, x)), max(20, min(180, y))
+        p.line(x, y, f=2400 if i == 0 else None)
+
+def travel(out, rnd):
+    p = Path(out)
+    for _ in range(int(300 * args.scale)):
+        p.retract(0.8)
+        p.line(rnd.uniform(20, 180), rnd.uniform(20, 180), f=12000, extrude=False)
+        p.retract(-0.8)
+        for _ in range(rnd.randint(1, 4)):
+            p.line(p.x + rnd.uniform(-3, 3), p.y + rnd.uniform(-3, 3), f=1800)
+
+for name, gen in (('vase', vase), ('arcs', arcs), ('small', small), ('travel', travel)):
+    path = os.path.join(args.output, name + '.gcode')
+    with open(path, 'w') as out:
+        header(out, name)
+        gen(out, random.Random('%s-%d' % (name, args.seed)))
+        footer(out)
+    print(path)